@@ -0,0 +1,124 @@
+#include <cmath>
+#include <cstdint>
+#include <memory>
+#include <thread>
+#include <vector>
+
+#include "Benchmark.hpp"
+
+#include "Engine/AudioMixer.hpp"
+
+#include "Utils/Simd.hpp"
+#include "Utils/SpscQueue.hpp"
+
+#include "Common/Constants.hpp"
+
+namespace
+{
+    constexpr int AUDIO_BENCH_SECONDS = 10;          // Audio rendered offline per iteration
+    constexpr float AUDIO_BENCH_SOUND_SECONDS = 1.5f; // Length of each synthetic sound
+    constexpr size_t SPSC_TRANSFERS = 1 << 16;       // Values the consumer takes per iteration
+
+    /**
+     * @brief Mixer holding one synthetic tone per sound ID, with `voices` looping voices spread across the stereo field.
+     */
+    std::unique_ptr<Engine::AudioMixer> makeMixer(int voices, Utils::SimdLevel level)
+    {
+        auto mixer = std::make_unique<Engine::AudioMixer>(Engine::AUDIO_DEFAULT_POOL_FRAMES, level);
+        std::vector<float> samples((size_t)(AUDIO_BENCH_SOUND_SECONDS * Engine::AUDIO_SAMPLE_RATE));
+        for (int id = 0; id < (int)Common::SoundID::SOUND_COUNT; id++)
+        {
+            const float frequency = 110.0f * (float)(id + 1);
+            for (size_t i = 0; i < samples.size(); i++)
+                samples[i] = 0.25f * std::sin(6.2831853f * frequency * (float)i / Engine::AUDIO_SAMPLE_RATE);
+            mixer->addSound((Common::SoundID)id, samples.data(), samples.size());
+        }
+        for (int i = 0; i < voices; i++)
+        {
+            const float pan = voices > 1 ? -1.0f + 2.0f * (float)i / (float)(voices - 1) : 0.0f;
+            mixer->play((Common::SoundID)(i % (int)Common::SoundID::SOUND_COUNT), 1.0f, pan, true);
+        }
+        return mixer;
+    }
+
+    /**
+     * @brief Offline render of AUDIO_BENCH_SECONDS into a buffer, as the audio callback would, with voices playing.
+     */
+    void runMix(Bench::State &state, int voices, Utils::SimdLevel level)
+    {
+        std::unique_ptr<Engine::AudioMixer> mixer = makeMixer(voices, level);
+        std::vector<float> buffer((size_t)AUDIO_BENCH_SECONDS * Engine::AUDIO_SAMPLE_RATE * Engine::AUDIO_CHANNELS);
+        for (auto _ : state)
+        {
+            // Device-sized calls, so command draining and block setup are paid as often as in a session
+            for (size_t frame = 0; frame < buffer.size() / Engine::AUDIO_CHANNELS; frame += Engine::AUDIO_DEVICE_FRAMES)
+                mixer->mix(buffer.data() + frame * Engine::AUDIO_CHANNELS, Engine::AUDIO_DEVICE_FRAMES);
+            Bench::doNotOptimize(buffer.data());
+        }
+        if (mixer->getStats().activeVoices != voices)
+            state.skipWithError("voices ended early");
+        state.setItemsProcessed((int64_t)(state.iterations() * (uint64_t)AUDIO_BENCH_SECONDS * Engine::AUDIO_SAMPLE_RATE));
+    }
+
+    /**
+     * @brief N simultaneous voices with the widest kernels the CPU supports; items are output frames.
+     */
+    void BM_AudioMixOffline(Bench::State &state)
+    {
+        runMix(state, (int)state.range(), Utils::detectSimdLevel());
+    }
+    BENCHMARK(BM_AudioMixOffline)->Arg(32)->Arg(128);
+
+    /**
+     * @brief Engine::AUDIO_MAX_VOICES voices with the kernels of one Utils::SimdLevel (0 scalar, 1 SSE, 2 AVX2).
+     */
+    void BM_AudioMixKernels(Bench::State &state)
+    {
+        const Utils::SimdLevel level = (Utils::SimdLevel)state.range();
+        if (Utils::clampToSupported(level) != level)
+        {
+            state.skipWithError("instruction set not supported");
+            return;
+        }
+        runMix(state, Engine::AUDIO_MAX_VOICES, level);
+    }
+    BENCHMARK(BM_AudioMixKernels)->Arg(0)->Arg(1)->Arg(2);
+
+    /**
+     * @brief Utils::SpscQueue hand-off from one producer thread to the benchmark thread, SPSC_TRANSFERS values per iteration.
+     */
+    void BM_SpscQueueTransfer(Bench::State &state)
+    {
+        Utils::SpscQueue<uint64_t> queue(Engine::AUDIO_COMMAND_CAPACITY);
+        for (auto _ : state)
+        {
+            std::thread producer([&queue]
+                                 {
+                for (size_t sent = 0; sent < SPSC_TRANSFERS; sent++)
+                {
+                    uint64_t value = 1;
+                    while (!queue.tryPush(value))
+                        std::this_thread::yield();
+                } });
+
+            uint64_t sum = 0;
+            uint64_t value;
+            for (size_t received = 0; received < SPSC_TRANSFERS;)
+            {
+                if (queue.tryPop(value))
+                {
+                    sum += value;
+                    received++;
+                }
+                else
+                {
+                    std::this_thread::yield();
+                }
+            }
+            producer.join();
+            Bench::doNotOptimize(sum);
+        }
+        state.setItemsProcessed((int64_t)(state.iterations() * SPSC_TRANSFERS));
+    }
+    BENCHMARK(BM_SpscQueueTransfer);
+}
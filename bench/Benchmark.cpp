@@ -0,0 +1,186 @@
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <ctime>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "Benchmark.hpp"
+
+namespace
+{
+    // Each benchmark runs until one batch of iterations takes at least this long
+    constexpr double MIN_RUN_SECONDS = 0.5;
+    constexpr uint64_t MAX_ITERATIONS = 1'000'000'000;
+
+    struct Result
+    {
+        std::string name;
+        uint64_t iterations = 0;
+        double realNs = 0.0; // Per iteration
+        double cpuNs = 0.0;
+        double itemsPerSecond = 0.0; // 0 when the benchmark reports no items
+        std::string error;           // Set when the benchmark skipped itself
+        bool failed = false;         // The error came from failWithError()
+    };
+
+    std::vector<std::unique_ptr<Bench::Benchmark>> &registry()
+    {
+        static std::vector<std::unique_ptr<Bench::Benchmark>> benchmarks;
+        return benchmarks;
+    }
+
+    /**
+     * @brief Runs one benchmark/argument pair, growing the iteration count until the run is long enough.
+     */
+    Result runBenchmark(const Bench::Benchmark &benchmark, int64_t arg, bool hasArg)
+    {
+        Result result;
+        result.name = benchmark.getName() + (hasArg ? "/" + std::to_string(arg) : "");
+
+        uint64_t iterations = 1;
+        while (true)
+        {
+            Bench::State state(iterations, arg);
+            benchmark.getFunction()(state);
+            if (!state.getError().empty())
+            {
+                result.error = state.getError();
+                result.failed = state.hasFailed();
+                return result;
+            }
+
+            const double seconds = state.getRealSeconds();
+            if (seconds >= MIN_RUN_SECONDS || iterations >= MAX_ITERATIONS)
+            {
+                result.iterations = iterations;
+                result.realNs = seconds * 1e9 / iterations;
+                result.cpuNs = state.getCpuSeconds() * 1e9 / iterations;
+                result.itemsPerSecond = seconds > 0.0 ? state.getItemsProcessed() / seconds : 0.0;
+                return result;
+            }
+
+            // Aim a little past the minimum, but never grow more than 10x per round
+            const double scale = seconds > 0.0 ? MIN_RUN_SECONDS * 1.4 / seconds : 10.0;
+            const uint64_t next = (uint64_t)(iterations * std::min(10.0, std::max(scale, 1.0))) + 1;
+            iterations = std::min(next, MAX_ITERATIONS);
+        }
+    }
+
+    /**
+     * @brief Writes results in Google Benchmark's JSON layout so its compare tooling can diff runs.
+     */
+    bool writeJson(const std::string &path, const std::vector<Result> &results)
+    {
+        std::FILE *file = std::fopen(path.c_str(), "w");
+        if (!file)
+        {
+            std::fprintf(stderr, "Could not open %s\n", path.c_str());
+            return false;
+        }
+
+        char date[64] = {};
+        const std::time_t now = std::time(nullptr);
+        std::strftime(date, sizeof(date), "%Y-%m-%dT%H:%M:%S", std::localtime(&now));
+
+        std::fprintf(file, "{\n  \"context\": {\n    \"date\": \"%s\",\n    \"num_cpus\": %u,\n", date, std::thread::hardware_concurrency());
+#ifdef NDEBUG
+        std::fputs("    \"library_build_type\": \"release\"\n  },\n", file);
+#else
+        std::fputs("    \"library_build_type\": \"debug\"\n  },\n", file);
+#endif
+        std::fputs("  \"benchmarks\": [", file);
+        for (size_t i = 0; i < results.size(); i++)
+        {
+            const Result &r = results[i];
+            std::fprintf(file, "%s\n    {\"name\": \"%s\", \"run_type\": \"iteration\", \"iterations\": %llu, "
+                               "\"real_time\": %.3f, \"cpu_time\": %.3f, \"time_unit\": \"ns\"",
+                         i ? "," : "", r.name.c_str(), (unsigned long long)r.iterations, r.realNs, r.cpuNs);
+            if (r.itemsPerSecond > 0.0)
+                std::fprintf(file, ", \"items_per_second\": %.1f", r.itemsPerSecond);
+            std::fputs("}", file);
+        }
+        std::fputs("\n  ]\n}\n", file);
+
+        if (std::fclose(file) != 0)
+        {
+            std::fprintf(stderr, "Failed to write %s\n", path.c_str());
+            return false;
+        }
+        return true;
+    }
+}
+
+namespace Bench
+{
+    Benchmark *registerBenchmark(const char *name, BenchmarkFn fn)
+    {
+        registry().push_back(std::make_unique<Benchmark>(name, fn));
+        return registry().back().get();
+    }
+} // namespace Bench
+
+/**
+ * @brief Runs every registered benchmark and prints a table; `--out <file>` also writes JSON.
+ *
+ * `--filter <text>` runs only benchmarks whose name (including the argument) contains `text`.
+ * Exits with 1 if any benchmark called failWithError().
+ */
+int main(int argc, char *argv[])
+{
+    std::string outPath;
+    std::string filter;
+    for (int i = 1; i < argc; i++)
+    {
+        if (std::strcmp(argv[i], "--out") == 0 && i + 1 < argc)
+            outPath = argv[++i];
+        else if (std::strcmp(argv[i], "--filter") == 0 && i + 1 < argc)
+            filter = argv[++i];
+        else
+        {
+            std::fprintf(stderr, "Usage: %s [--out results.json] [--filter text]\n", argv[0]);
+            return 1;
+        }
+    }
+
+    std::printf("%-40s %14s %14s %12s %16s\n", "Benchmark", "Time (ns)", "CPU (ns)", "Iterations", "Items/s");
+    std::vector<Result> results;
+    int failures = 0;
+    for (const auto &benchmark : registry())
+    {
+        std::vector<int64_t> args = benchmark->getArgs();
+        const bool hasArgs = !args.empty();
+        if (!hasArgs)
+            args.push_back(0);
+
+        for (int64_t arg : args)
+        {
+            const std::string name = benchmark->getName() + (hasArgs ? "/" + std::to_string(arg) : "");
+            if (!filter.empty() && name.find(filter) == std::string::npos)
+                continue;
+
+            const Result result = runBenchmark(*benchmark, arg, hasArgs);
+            if (!result.error.empty())
+            {
+                std::printf("%-40s %s: %s\n", result.name.c_str(), result.failed ? "FAILED" : "skipped", result.error.c_str());
+                failures += result.failed ? 1 : 0;
+                continue;
+            }
+            std::printf("%-40s %14.1f %14.1f %12llu %16.0f\n", result.name.c_str(), result.realNs, result.cpuNs,
+                        (unsigned long long)result.iterations, result.itemsPerSecond);
+            std::fflush(stdout);
+            results.push_back(result);
+        }
+    }
+
+    if (!outPath.empty())
+    {
+        if (!writeJson(outPath, results))
+            return 1;
+        std::printf("Results written to %s\n", outPath.c_str());
+    }
+    return failures > 0 ? 1 : 0;
+}
@@ -0,0 +1,162 @@
+#pragma once
+#include <chrono>
+#include <cstdint>
+#include <ctime>
+#include <string>
+#include <vector>
+
+namespace Bench
+{
+    /**
+     * @brief Per-run state handed to a benchmark function; iterate it to run the timed loop.
+     *
+     * @code
+     * void BM_Example(Bench::State &state)
+     * {
+     *     setup(state.range());
+     *     for (auto _ : state)
+     *         Bench::doNotOptimize(work());
+     *     state.setItemsProcessed(state.iterations() * state.range());
+     * }
+     * BENCHMARK(BM_Example)->Arg(1000)->Arg(10000);
+     * @endcode
+     */
+    class State
+    {
+    public:
+        // Loop variable type; the user-provided destructor keeps `for (auto _ : state)` free of unused warnings
+        struct Value
+        {
+            ~Value() {}
+        };
+
+        struct Iterator
+        {
+            State *state;
+            uint64_t remaining;
+
+            bool operator!=(const Iterator &) const
+            {
+                if (remaining != 0)
+                    return true;
+                state->stopTiming();
+                return false;
+            }
+            void operator++() { remaining--; }
+            Value operator*() const { return {}; }
+        };
+
+        State(uint64_t iterations, int64_t arg) : m_iterations(iterations), m_arg(arg) {}
+
+        Iterator begin()
+        {
+            startTiming();
+            return {this, m_iterations};
+        }
+        Iterator end() { return {this, 0}; }
+
+        /**
+         * @brief Excludes the following code from the measurement until resumeTiming().
+         */
+        void pauseTiming() { stopTiming(); }
+        void resumeTiming() { startTiming(); }
+
+        int64_t range() const { return m_arg; }
+        uint64_t iterations() const { return m_iterations; }
+
+        void setItemsProcessed(int64_t items) { m_itemsProcessed = items; }
+        int64_t getItemsProcessed() const { return m_itemsProcessed; }
+
+        /**
+         * @brief Marks the run as failed (e.g. missing SDL video driver); return without entering the loop.
+         */
+        void skipWithError(const std::string &message) { m_error = message; }
+        const std::string &getError() const { return m_error; }
+
+        /**
+         * @brief Like skipWithError(), for wrong results rather than a missing prerequisite: the run exits with an error.
+         */
+        void failWithError(const std::string &message)
+        {
+            m_error = message;
+            m_failed = true;
+        }
+        bool hasFailed() const { return m_failed; }
+
+        double getRealSeconds() const { return m_realSeconds; }
+        double getCpuSeconds() const { return m_cpuSeconds; }
+
+    private:
+        void startTiming()
+        {
+            m_cpuStart = std::clock();
+            m_realStart = std::chrono::steady_clock::now();
+        }
+        void stopTiming()
+        {
+            m_realSeconds += std::chrono::duration<double>(std::chrono::steady_clock::now() - m_realStart).count();
+            m_cpuSeconds += (double)(std::clock() - m_cpuStart) / CLOCKS_PER_SEC;
+        }
+
+        uint64_t m_iterations;
+        int64_t m_arg;
+        int64_t m_itemsProcessed = 0;
+        std::string m_error;
+        bool m_failed = false;
+        std::chrono::steady_clock::time_point m_realStart;
+        std::clock_t m_cpuStart = 0;
+        double m_realSeconds = 0.0;
+        double m_cpuSeconds = 0.0;
+    };
+
+    using BenchmarkFn = void (*)(State &);
+
+    // A registered benchmark; runs once per Arg(), or once with arg 0 when it has none
+    class Benchmark
+    {
+    public:
+        Benchmark(const char *name, BenchmarkFn fn) : m_name(name), m_fn(fn) {}
+
+        Benchmark *Arg(int64_t arg)
+        {
+            m_args.push_back(arg);
+            return this;
+        }
+
+        const std::string &getName() const { return m_name; }
+        BenchmarkFn getFunction() const { return m_fn; }
+        const std::vector<int64_t> &getArgs() const { return m_args; }
+
+    private:
+        std::string m_name;
+        BenchmarkFn m_fn;
+        std::vector<int64_t> m_args;
+    };
+
+    /**
+     * @brief Adds a benchmark to the global list run by main(). Use the BENCHMARK macro instead.
+     */
+    Benchmark *registerBenchmark(const char *name, BenchmarkFn fn);
+
+    /**
+     * @brief Keeps the compiler from discarding `value` or the computation producing it.
+     */
+    template <typename T>
+    inline void doNotOptimize(const T &value)
+    {
+        asm volatile("" : : "r,m"(value) : "memory");
+    }
+
+    /**
+     * @brief Forces pending memory writes to be treated as observable.
+     */
+    inline void clobberMemory()
+    {
+        asm volatile("" : : : "memory");
+    }
+} // namespace Bench
+
+#define BENCH_CONCAT_INNER(a, b) a##b
+#define BENCH_CONCAT(a, b) BENCH_CONCAT_INNER(a, b)
+#define BENCHMARK(fn) \
+    [[maybe_unused]] static Bench::Benchmark *BENCH_CONCAT(benchmarkRegistration, __LINE__) = Bench::registerBenchmark(#fn, fn)
@@ -0,0 +1,524 @@
+#include <SDL3/SDL.h>
+#include <cstdint>
+#include <cstring>
+#include <filesystem>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "Benchmark.hpp"
+
+#include "Engine/CpuRenderer.hpp"
+#include "Engine/InputManager.hpp"
+#include "Engine/Rasterizer.hpp"
+#include "Engine/SdlRenderer.hpp"
+
+#include "Gameplay/EntityStore.hpp"
+#include "Gameplay/MovementKernel.hpp"
+#include "Gameplay/MovementProfile.hpp"
+#include "Gameplay/PlayerMovement.hpp"
+#include "Gameplay/Tilemap.hpp"
+
+#include "Utils/JobSystem.hpp"
+#include "Utils/Simd.hpp"
+
+#include "Common/Constants.hpp"
+#include "Common/Types.hpp"
+
+namespace
+{
+    constexpr int SPRITE_SIZE = 32;
+
+    // Deterministic inputs so runs are comparable between versions
+    struct Lcg
+    {
+        uint32_t state = 12345;
+        uint32_t next()
+        {
+            state = state * 1664525u + 1013904223u;
+            return state >> 8;
+        }
+        float nextFloat(float max) { return (float)(next() & 0xFFFF) / 65535.0f * max; }
+    };
+
+    /**
+     * @brief Hidden window with a software SdlRenderer, plus a windowless CpuRenderer, both loaded with generated sprites.
+     *
+     * Prefers SDL's offscreen video driver and falls back to the dummy one, so the benchmarks run on
+     * machines without a display. Sprites are written as BMPs to the temp directory and loaded through
+     * Renderer::loadTexture(), the same path the game uses.
+     */
+    struct RenderFixture
+    {
+        SDL_Window *window = nullptr;
+        std::unique_ptr<Engine::SdlRenderer> renderer;
+        std::unique_ptr<Utils::JobSystem> jobs;
+        std::unique_ptr<Engine::CpuRenderer> cpuRenderer;
+        std::string error;
+
+        RenderFixture()
+        {
+            SDL_SetHint(SDL_HINT_RENDER_DRIVER, "software");
+            SDL_SetHint(SDL_HINT_VIDEO_DRIVER, "offscreen");
+            if (!SDL_Init(SDL_INIT_VIDEO))
+            {
+                SDL_SetHint(SDL_HINT_VIDEO_DRIVER, "dummy");
+                if (!SDL_Init(SDL_INIT_VIDEO))
+                {
+                    error = std::string("SDL_Init failed: ") + SDL_GetError();
+                    return;
+                }
+            }
+
+            window = SDL_CreateWindow("bench", Common::SCREEN_WIDTH, Common::SCREEN_HEIGHT, SDL_WINDOW_HIDDEN);
+            if (!window)
+            {
+                error = std::string("SDL_CreateWindow failed: ") + SDL_GetError();
+                return;
+            }
+            renderer = std::make_unique<Engine::SdlRenderer>(window);
+            jobs = std::make_unique<Utils::JobSystem>();
+            cpuRenderer = std::make_unique<Engine::CpuRenderer>(nullptr, jobs.get());
+
+            const std::filesystem::path directory = std::filesystem::temp_directory_path();
+            for (int id = 0; id < (int)Common::TextureID::TEX_COUNT; id++)
+            {
+                const std::string path = (directory / ("bench_sprite_" + std::to_string(id) + ".bmp")).string();
+                SDL_Surface *surface = SDL_CreateSurface(SPRITE_SIZE, SPRITE_SIZE, SDL_PIXELFORMAT_RGBA32);
+                if (!surface)
+                    continue;
+                SDL_FillSurfaceRect(surface, nullptr, SDL_MapSurfaceRGBA(surface, (Uint8)(id * 50), 128, 200, 255));
+                const bool saved = SDL_SaveBMP(surface, path.c_str());
+                SDL_DestroySurface(surface);
+                if (saved)
+                {
+                    renderer->loadTexture((Common::TextureID)id, path);
+                    cpuRenderer->loadTexture((Common::TextureID)id, path);
+                    std::filesystem::remove(path);
+                }
+            }
+            renderer->buildAtlas();
+            cpuRenderer->buildAtlas();
+        }
+
+        ~RenderFixture()
+        {
+            cpuRenderer.reset();
+            jobs.reset();
+            renderer.reset();
+            if (window)
+                SDL_DestroyWindow(window);
+            SDL_Quit();
+        }
+    };
+
+    RenderFixture &renderFixture()
+    {
+        static RenderFixture fixture;
+        return fixture;
+    }
+
+    /**
+     * @brief On-screen commands spread over every texture and both layers, in shuffled order.
+     */
+    Utils::FrameVector<Common::RenderCommand> makeCommands(size_t count)
+    {
+        Lcg random;
+        Utils::FrameVector<Common::RenderCommand> commands;
+        commands.reserve(count);
+        for (size_t i = 0; i < count; i++)
+        {
+            Common::RenderCommand command;
+            command.x = random.nextFloat((float)Common::SCREEN_WIDTH);
+            command.y = random.nextFloat((float)Common::SCREEN_HEIGHT);
+            command.width = (float)SPRITE_SIZE;
+            command.height = (float)SPRITE_SIZE;
+            command.textureID = (Common::TextureID)(random.next() % (uint32_t)Common::TextureID::TEX_COUNT);
+            command.layer = command.textureID == Common::TextureID::TEX_WALL || command.textureID == Common::TextureID::TEX_FLOOR
+                                ? Common::LAYER_TILES
+                                : Common::LAYER_ENTITIES;
+            commands.push_back(command);
+        }
+        return commands;
+    }
+
+    /**
+     * @brief Movement update over N player entities on the test level, one fixed step per entity.
+     */
+    template <typename Movement>
+    void runPlayerMovement(Bench::State &state, const Movement &movement)
+    {
+        const size_t count = (size_t)state.range();
+        const Gameplay::Tilemap level = Gameplay::Tilemap::createTestLevel(16, 4);
+        Gameplay::EntityStore entities;
+        entities.reserve(count);
+        std::vector<Gameplay::EntityHandle> handles;
+        handles.reserve(count);
+
+        Lcg random;
+        for (size_t i = 0; i < count; i++)
+        {
+            const float x = Common::TILE_SIZE * 2 + random.nextFloat(level.getPixelWidth() - Common::TILE_SIZE * 4 - Common::PLAYER_WIDTH);
+            const float y = Common::TILE_SIZE * 2 + random.nextFloat(level.getPixelHeight() / 2);
+            handles.push_back(entities.create(Gameplay::EntityKind::ENTITY_PLAYER, x, y, Common::PLAYER_WIDTH, Common::PLAYER_HEIGHT,
+                                              Common::TextureID::TEX_PLAYER));
+        }
+
+        Common::InputState input;
+        uint64_t step = 0;
+        for (auto _ : state)
+        {
+            // Alternate direction every second of simulated time and jump now and then
+            input.right = (step / 60) % 2 == 0;
+            input.left = !input.right;
+            input.jump = step % 45 == 0;
+            for (Gameplay::EntityHandle handle : handles)
+            {
+                movement.update(entities, handle, Common::TIME_STEP, input, level);
+            }
+            Bench::clobberMemory();
+            step++;
+        }
+        state.setItemsProcessed((int64_t)(state.iterations() * count));
+    }
+
+    /**
+     * @brief PlayerMovement with the compile-time PlayerProfile.
+     */
+    void BM_PlayerMovementUpdate(Bench::State &state)
+    {
+        runPlayerMovement(state, Gameplay::PlayerMovement());
+    }
+    BENCHMARK(BM_PlayerMovementUpdate)->Arg(1000)->Arg(10000)->Arg(100000);
+
+    /**
+     * @brief Same values through the runtime TunableProfile, for comparison with BM_PlayerMovementUpdate.
+     */
+    void BM_PlayerMovementTunable(Bench::State &state)
+    {
+        runPlayerMovement(state, Gameplay::TunablePlayerMovement());
+    }
+    BENCHMARK(BM_PlayerMovementTunable)->Arg(1000)->Arg(10000)->Arg(100000);
+
+    constexpr size_t KERNEL_ENTITIES = 10000;     // Entities per updateVelocities() call in BM_MovementKernel
+    constexpr int KERNEL_CHECK_BATCHES = 200;     // Random batches compared against the scalar kernel first
+    constexpr size_t KERNEL_CHECK_ENTITIES = 1003; // Not a multiple of the vector width, so the scalar tail runs too
+
+    // Velocity columns for updateVelocities(): intents of -1, 0 and +1, speeds on both sides of every clamp
+    struct KernelBatch
+    {
+        std::vector<float> moveDir, velX, velY;
+
+        KernelBatch(Lcg &random, size_t count) : moveDir(count), velX(count), velY(count)
+        {
+            for (size_t i = 0; i < count; i++)
+            {
+                moveDir[i] = (float)(int)(random.next() % 3) - 1.0f;
+                velX[i] = random.nextFloat(1200.0f) - 600.0f;
+                velY[i] = random.nextFloat(7000.0f) - 1000.0f;
+            }
+        }
+    };
+
+    /**
+     * @brief Whether updateVelocities() at `level` produces the same bits as the scalar kernel on random batches.
+     */
+    bool movementKernelMatchesScalar(Utils::SimdLevel level, const Gameplay::MovementParams &params)
+    {
+        Lcg random;
+        for (int batch = 0; batch < KERNEL_CHECK_BATCHES; batch++)
+        {
+            KernelBatch scalar(random, KERNEL_CHECK_ENTITIES);
+            KernelBatch vector = scalar;
+            Gameplay::updateVelocities(Utils::SimdLevel::SIMD_SCALAR, params, scalar.moveDir.data(), scalar.velX.data(), scalar.velY.data(),
+                                       KERNEL_CHECK_ENTITIES, Common::TIME_STEP);
+            Gameplay::updateVelocities(level, params, vector.moveDir.data(), vector.velX.data(), vector.velY.data(), KERNEL_CHECK_ENTITIES,
+                                       Common::TIME_STEP);
+            if (std::memcmp(scalar.velX.data(), vector.velX.data(), KERNEL_CHECK_ENTITIES * sizeof(float)) != 0 ||
+                std::memcmp(scalar.velY.data(), vector.velY.data(), KERNEL_CHECK_ENTITIES * sizeof(float)) != 0)
+                return false;
+        }
+        return true;
+    }
+
+    /**
+     * @brief Enemy velocity kernel over KERNEL_ENTITIES entities, per SIMD level (0 scalar, 1 SSE2, 2 AVX2).
+     *
+     * Fails instead of timing if the level's results differ from the scalar kernel's in any bit.
+     */
+    void BM_MovementKernel(Bench::State &state)
+    {
+        const Utils::SimdLevel level = (Utils::SimdLevel)state.range();
+        if (Utils::clampToSupported(level) != level)
+        {
+            state.skipWithError(std::string(Utils::simdLevelName(level)) + " not supported on this CPU");
+            return;
+        }
+
+        constexpr Gameplay::MovementParams params = Gameplay::toMovementParams<Gameplay::EnemyProfile>();
+        if (!movementKernelMatchesScalar(level, params))
+        {
+            state.failWithError(std::string(Utils::simdLevelName(level)) + " velocities differ from the scalar kernel");
+            return;
+        }
+
+        Lcg random;
+        KernelBatch batch(random, KERNEL_ENTITIES);
+        for (auto _ : state)
+        {
+            Gameplay::updateVelocities(level, params, batch.moveDir.data(), batch.velX.data(), batch.velY.data(), KERNEL_ENTITIES, Common::TIME_STEP);
+            Bench::clobberMemory();
+        }
+        state.setItemsProcessed((int64_t)(state.iterations() * KERNEL_ENTITIES));
+    }
+    BENCHMARK(BM_MovementKernel)->Arg(0)->Arg(1)->Arg(2);
+
+    /**
+     * @brief SdlRenderer::drawCommands (sort, batch, submit) on the software renderer; clearing and
+     * presenting are not timed.
+     */
+    void BM_RendererDrawCommands(Bench::State &state)
+    {
+        RenderFixture &fixture = renderFixture();
+        if (!fixture.error.empty())
+        {
+            state.skipWithError(fixture.error);
+            return;
+        }
+
+        const Utils::FrameVector<Common::RenderCommand> commands = makeCommands((size_t)state.range());
+        for (auto _ : state)
+        {
+            state.pauseTiming();
+            fixture.renderer->beginFrame();
+            state.resumeTiming();
+
+            fixture.renderer->drawCommands(commands);
+
+            state.pauseTiming();
+            fixture.renderer->endFrame();
+            state.resumeTiming();
+        }
+        state.setItemsProcessed((int64_t)(state.iterations() * commands.size()));
+    }
+    BENCHMARK(BM_RendererDrawCommands)->Arg(1000)->Arg(10000)->Arg(100000);
+
+    /**
+     * @brief SdlRenderer::drawParticles (vertex build and one geometry submission) for N particles on the
+     * software renderer, which also rasterizes them inside the timed call.
+     */
+    void BM_RendererDrawParticles(Bench::State &state)
+    {
+        RenderFixture &fixture = renderFixture();
+        if (!fixture.error.empty())
+        {
+            state.skipWithError(fixture.error);
+            return;
+        }
+
+        Lcg random;
+        Utils::FrameVector<Common::ParticleInstance> particles;
+        particles.reserve((size_t)state.range());
+        for (int64_t i = 0; i < state.range(); i++)
+        {
+            Common::ParticleInstance particle;
+            particle.x = random.nextFloat((float)Common::SCREEN_WIDTH);
+            particle.y = random.nextFloat((float)Common::SCREEN_HEIGHT);
+            particle.size = 4.0f;
+            particle.color = random.next() | 0x80;
+            particles.push_back(particle);
+        }
+
+        for (auto _ : state)
+        {
+            state.pauseTiming();
+            fixture.renderer->beginFrame();
+            state.resumeTiming();
+
+            fixture.renderer->drawParticles(particles);
+
+            state.pauseTiming();
+            fixture.renderer->endFrame();
+            state.resumeTiming();
+        }
+        state.setItemsProcessed((int64_t)(state.iterations() * particles.size()));
+    }
+    BENCHMARK(BM_RendererDrawParticles)->Arg(10000)->Arg(100000);
+
+    /**
+     * @brief Whole CpuRenderer frame for N sprite commands: recording, tile binning and parallel
+     * rasterization, without the upload since the fixture's CPU renderer has no window.
+     */
+    void BM_CpuRendererFrame(Bench::State &state)
+    {
+        RenderFixture &fixture = renderFixture();
+        if (!fixture.error.empty())
+        {
+            state.skipWithError(fixture.error);
+            return;
+        }
+
+        const Utils::FrameVector<Common::RenderCommand> commands = makeCommands((size_t)state.range());
+        for (auto _ : state)
+        {
+            fixture.cpuRenderer->beginFrame();
+            fixture.cpuRenderer->drawCommands(commands);
+            fixture.cpuRenderer->endFrame();
+            Bench::doNotOptimize(fixture.cpuRenderer->getPixels());
+        }
+        state.setItemsProcessed((int64_t)(state.iterations() * commands.size()));
+    }
+    BENCHMARK(BM_CpuRendererFrame)->Arg(1000)->Arg(10000);
+
+    constexpr size_t SPAN_CHECK_MAX_LENGTH = 67; // Every span length up to here, so each vector loop leaves every possible tail
+    constexpr int SPAN_CHECK_ROUNDS = 16;         // Random spans per length
+
+    // Pixel with alpha 0, 255 or anything in between, premultiplied as the rasterizer expects
+    uint32_t randomSpanPixel(Lcg &random)
+    {
+        const uint32_t pick = random.next() % 4;
+        const uint32_t alpha = pick == 0 ? 0x00 : pick == 1 ? 0xFF : random.next() & 0xFF;
+        return Engine::premultiplyArgb(alpha << 24 | (random.next() & 0xFFFFFF));
+    }
+
+    /**
+     * @brief Whether the span kernels at `level` write the same bits as the scalar ones, for every length up to
+     * SPAN_CHECK_MAX_LENGTH at a misaligned start.
+     */
+    bool spanKernelsMatchScalar(Utils::SimdLevel level)
+    {
+        const Engine::SpanKernels &scalar = Engine::getSpanKernels(Utils::SimdLevel::SIMD_SCALAR);
+        const Engine::SpanKernels &vector = Engine::getSpanKernels(level);
+        Lcg random;
+        std::vector<uint32_t> source(SPAN_CHECK_MAX_LENGTH + 1), expected(SPAN_CHECK_MAX_LENGTH + 1), actual(SPAN_CHECK_MAX_LENGTH + 1);
+        for (size_t length = 0; length <= SPAN_CHECK_MAX_LENGTH; length++)
+        {
+            for (int round = 0; round < SPAN_CHECK_ROUNDS; round++)
+            {
+                for (size_t i = 0; i <= SPAN_CHECK_MAX_LENGTH; i++)
+                {
+                    source[i] = randomSpanPixel(random);
+                    expected[i] = 0xFF000000 | random.next();
+                }
+                const uint32_t color = randomSpanPixel(random);
+
+                actual = expected;
+                scalar.blendPixels(expected.data() + 1, source.data() + 1, length);
+                vector.blendPixels(actual.data() + 1, source.data() + 1, length);
+                if (std::memcmp(expected.data(), actual.data(), actual.size() * sizeof(uint32_t)) != 0)
+                    return false;
+
+                scalar.blendColor(expected.data() + 1, length, color);
+                vector.blendColor(actual.data() + 1, length, color);
+                if (std::memcmp(expected.data(), actual.data(), actual.size() * sizeof(uint32_t)) != 0)
+                    return false;
+
+                scalar.fill(expected.data() + 1, length, color);
+                vector.fill(actual.data() + 1, length, color);
+                if (std::memcmp(expected.data(), actual.data(), actual.size() * sizeof(uint32_t)) != 0)
+                    return false;
+            }
+        }
+        return true;
+    }
+
+    /**
+     * @brief Rasterizer blendPixels over one full-screen frame of spans, per SIMD level (0 scalar, 1 SSE2, 2 AVX2).
+     *
+     * Fails instead of timing if any span kernel of the level writes different pixels than the scalar one.
+     */
+    void BM_RasterBlendSpans(Bench::State &state)
+    {
+        const Utils::SimdLevel level = (Utils::SimdLevel)state.range();
+        if (Utils::clampToSupported(level) != level)
+        {
+            state.skipWithError(std::string(Utils::simdLevelName(level)) + " not supported on this CPU");
+            return;
+        }
+        if (!spanKernelsMatchScalar(level))
+        {
+            state.failWithError(std::string(Utils::simdLevelName(level)) + " span kernels differ from the scalar ones");
+            return;
+        }
+
+        const Engine::SpanKernels &kernels = Engine::getSpanKernels(level);
+        constexpr size_t PIXELS = (size_t)Common::SCREEN_WIDTH * Common::SCREEN_HEIGHT;
+        Lcg random;
+        std::vector<uint32_t> source(PIXELS), frame(PIXELS);
+        for (uint32_t &pixel : source)
+            pixel = Engine::premultiplyArgb(random.next() << 8 | (random.next() & 0xFF));
+        for (uint32_t &pixel : frame)
+            pixel = 0xFF000000 | random.next();
+
+        for (auto _ : state)
+        {
+            kernels.blendPixels(frame.data(), source.data(), PIXELS);
+            Bench::clobberMemory();
+        }
+        state.setItemsProcessed((int64_t)(state.iterations() * PIXELS));
+    }
+    BENCHMARK(BM_RasterBlendSpans)->Arg(0)->Arg(1)->Arg(2);
+
+    /**
+     * @brief Atlas region lookups by texture ID, as drawCommands() does twice per command.
+     */
+    void BM_TextureCacheLookup(Bench::State &state)
+    {
+        RenderFixture &fixture = renderFixture();
+        if (!fixture.error.empty())
+        {
+            state.skipWithError(fixture.error);
+            return;
+        }
+
+        constexpr int LOOKUPS = 4096;
+        const int textureCount = (int)Common::TextureID::TEX_COUNT;
+        for (auto _ : state)
+        {
+            for (int i = 0; i < LOOKUPS; i++)
+            {
+                Bench::doNotOptimize(fixture.renderer->findRegion((Common::TextureID)(i % textureCount)));
+            }
+        }
+        state.setItemsProcessed((int64_t)state.iterations() * LOOKUPS);
+    }
+    BENCHMARK(BM_TextureCacheLookup);
+
+    /**
+     * @brief InputManager::update and drainEvents with N queued key events (half presses, half releases).
+     */
+    void BM_InputPolling(Bench::State &state)
+    {
+        RenderFixture &fixture = renderFixture();
+        if (!fixture.error.empty())
+        {
+            state.skipWithError(fixture.error);
+            return;
+        }
+
+        const int eventCount = (int)state.range();
+        Engine::InputManager input;
+        std::vector<Engine::InputEvent> events;
+        events.reserve(Engine::INPUT_QUEUE_CAPACITY);
+        for (auto _ : state)
+        {
+            state.pauseTiming();
+            for (int i = 0; i < eventCount; i++)
+            {
+                SDL_Event event{};
+                event.type = i % 2 == 0 ? SDL_EVENT_KEY_DOWN : SDL_EVENT_KEY_UP;
+                event.key.scancode = SDL_SCANCODE_SPACE;
+                event.key.down = i % 2 == 0;
+                SDL_PushEvent(&event);
+            }
+            state.resumeTiming();
+
+            Bench::doNotOptimize(input.update());
+            events.clear();
+            input.drainEvents(events);
+            Bench::doNotOptimize(events.data());
+        }
+        state.setItemsProcessed((int64_t)state.iterations() * eventCount);
+    }
+    BENCHMARK(BM_InputPolling)->Arg(0)->Arg(16)->Arg(256);
+}
@@ -0,0 +1,123 @@
+#include <cstdint>
+#include <filesystem>
+#include <map>
+#include <string>
+
+#include "Benchmark.hpp"
+
+#include "Gameplay/Level.hpp"
+#include "Gameplay/Tilemap.hpp"
+
+#include "Common/Constants.hpp"
+
+namespace
+{
+    /**
+     * @brief Test levels written once per size to the temp directory and removed on exit.
+     *
+     * The arg of every benchmark here is the level's width and height in chunks; 128 is a 4096 x 4096 tile map.
+     */
+    class LevelFiles
+    {
+    public:
+        ~LevelFiles()
+        {
+            for (const auto &[chunks, path] : m_paths)
+                std::filesystem::remove(path);
+        }
+
+        /**
+         * @brief Path of the level with `chunks` x `chunks` chunks, or an empty string if it could not be written.
+         */
+        const std::string &get(int chunks)
+        {
+            auto it = m_paths.find(chunks);
+            if (it != m_paths.end())
+                return it->second;
+
+            const std::string path = (std::filesystem::temp_directory_path() / ("bench_level_" + std::to_string(chunks) + ".lvl")).string();
+            const Gameplay::Tilemap map = Gameplay::Tilemap::createTestLevel(chunks, chunks);
+            const bool written = Gameplay::writeLevel(path, map, Gameplay::createTestSpawns(map));
+            return m_paths[chunks] = written ? path : std::string();
+        }
+
+    private:
+        std::map<int, std::string> m_paths;
+    };
+
+    LevelFiles &levelFiles()
+    {
+        static LevelFiles files;
+        return files;
+    }
+
+    /**
+     * @brief What the game did before level files: generate the whole map in memory.
+     */
+    void BM_TilemapGenerate(Bench::State &state)
+    {
+        const int chunks = (int)state.range();
+        for (auto _ : state)
+        {
+            Gameplay::Tilemap map = Gameplay::Tilemap::createTestLevel(chunks, chunks);
+            Bench::doNotOptimize(map.getTileData());
+        }
+        state.setItemsProcessed((int64_t)(state.iterations() * chunks * chunks));
+    }
+    BENCHMARK(BM_TilemapGenerate)->Arg(32)->Arg(128);
+
+    /**
+     * @brief Startup cost of a level file: map, validate and wrap the tiles in a Tilemap.
+     *
+     * No tile page is touched, so this stays flat as the level grows apart from the chunk table check.
+     */
+    void BM_LevelOpen(Bench::State &state)
+    {
+        const std::string &path = levelFiles().get((int)state.range());
+        if (path.empty())
+        {
+            state.skipWithError("could not write the level file");
+            return;
+        }
+
+        for (auto _ : state)
+        {
+            Gameplay::Level level;
+            level.open(path);
+            Gameplay::Tilemap map = level.createTilemap();
+            Bench::doNotOptimize(map.getTileData());
+        }
+        state.setItemsProcessed((int64_t)state.iterations());
+    }
+    BENCHMARK(BM_LevelOpen)->Arg(32)->Arg(128);
+
+    /**
+     * @brief Open plus one read per page of tiles, i.e. the page faults a full traversal pays on a cached file.
+     */
+    void BM_LevelOpenAndTouch(Bench::State &state)
+    {
+        constexpr size_t PAGE_SIZE = 4096;
+        const int chunks = (int)state.range();
+        const std::string &path = levelFiles().get(chunks);
+        if (path.empty())
+        {
+            state.skipWithError("could not write the level file");
+            return;
+        }
+
+        const size_t tileBytes = (size_t)chunks * chunks * Common::CHUNK_SIZE * Common::CHUNK_SIZE;
+        for (auto _ : state)
+        {
+            Gameplay::Level level;
+            level.open(path);
+            Gameplay::Tilemap map = level.createTilemap();
+            const uint8_t *tiles = (const uint8_t *)map.getTileData();
+            uint32_t sum = 0;
+            for (size_t offset = 0; offset < tileBytes; offset += PAGE_SIZE)
+                sum += tiles[offset];
+            Bench::doNotOptimize(sum);
+        }
+        state.setItemsProcessed((int64_t)(state.iterations() * (tileBytes / PAGE_SIZE)));
+    }
+    BENCHMARK(BM_LevelOpenAndTouch)->Arg(32)->Arg(128);
+} // namespace
@@ -0,0 +1,85 @@
+#include <cstdint>
+
+#include "Benchmark.hpp"
+
+#include "Gameplay/Camera.hpp"
+#include "Gameplay/ParticleSystem.hpp"
+
+#include "Utils/FrameArena.hpp"
+
+#include "Common/Constants.hpp"
+#include "Common/Types.hpp"
+
+namespace
+{
+    // Long-lived spray so a steady population stays around N between refills
+    constexpr Gameplay::ParticleBurst BENCH_BURST = {64, 20.0f, 200.0f, -1.5707963f, 3.14159265f, 0.5f, 2.0f, 300.0f, 4.0f, 0xFFFFFFFF};
+
+    /**
+     * @brief Emits bursts spread over the screen until the system holds `count` particles.
+     */
+    void refill(Gameplay::ParticleSystem &particles, size_t count, uint32_t &seed)
+    {
+        while (particles.size() < count)
+        {
+            seed = seed * 1664525u + 1013904223u;
+            const float x = (float)((seed >> 8) % Common::SCREEN_WIDTH);
+            const float y = (float)((seed >> 20) % Common::SCREEN_HEIGHT);
+            particles.emit(BENCH_BURST, x, y);
+        }
+    }
+
+    /**
+     * @brief One step of N live particles: integrate and expire only.
+     */
+    void BM_ParticleUpdate(Bench::State &state)
+    {
+        const size_t count = (size_t)state.range();
+        Gameplay::ParticleSystem particles(count + (size_t)BENCH_BURST.count);
+        uint32_t seed = 1;
+        refill(particles, count, seed);
+
+        for (auto _ : state)
+        {
+            state.pauseTiming();
+            refill(particles, count, seed);
+            state.resumeTiming();
+
+            particles.update(Common::TIME_STEP);
+            Bench::clobberMemory();
+        }
+        state.setItemsProcessed((int64_t)(state.iterations() * count));
+    }
+    BENCHMARK(BM_ParticleUpdate)->Arg(10000)->Arg(100000);
+
+    /**
+     * @brief The per-frame particle budget on the simulation side: update, then build the frame's instance list.
+     *
+     * The renderer-side half is BM_RendererDrawParticles.
+     */
+    void BM_ParticleUpdateAndCollect(Bench::State &state)
+    {
+        const size_t count = (size_t)state.range();
+        Gameplay::ParticleSystem particles(count + (size_t)BENCH_BURST.count);
+        uint32_t seed = 1;
+        refill(particles, count, seed);
+
+        const Gameplay::Camera camera;
+        Utils::FrameArena arena(4 * 1024 * 1024);
+        for (auto _ : state)
+        {
+            state.pauseTiming();
+            refill(particles, count, seed);
+            arena.reset();
+            state.resumeTiming();
+
+            Utils::FrameVector<Common::ParticleInstance> instances{Utils::FrameAllocator<Common::ParticleInstance>(&arena)};
+            instances.reserve(count);
+            particles.update(Common::TIME_STEP);
+            particles.collectInstances(camera, 0.5f, instances);
+            Bench::doNotOptimize(instances.data());
+        }
+        state.setItemsProcessed((int64_t)(state.iterations() * count));
+    }
+    BENCHMARK(BM_ParticleUpdateAndCollect)->Arg(10000)->Arg(100000);
+}
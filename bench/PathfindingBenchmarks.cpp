@@ -0,0 +1,119 @@
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#include "Benchmark.hpp"
+
+#include "Gameplay/FlowField.hpp"
+#include "Gameplay/Tilemap.hpp"
+
+#include "Utils/JobSystem.hpp"
+
+#include "Common/Constants.hpp"
+
+namespace
+{
+    /**
+     * @brief Test level of N x N chunks filled with staggered platforms every third row, all reachable by jumping.
+     */
+    Gameplay::Tilemap makeTower(int chunks)
+    {
+        Gameplay::Tilemap map = Gameplay::Tilemap::createTestLevel(chunks, chunks);
+        const int width = map.getWidthInTiles();
+        const int height = map.getHeightInTiles();
+        uint32_t seed = 12345;
+        for (int y = 5; y < height - 4; y += 3)
+        {
+            for (int x = 2; x + 8 < width; x += 9)
+            {
+                seed = seed * 1664525u + 1013904223u;
+                const int offset = (int)((seed >> 24) % 3);
+                for (int i = 0; i < 6; i++)
+                    map.setTile(x + offset + i, y, Gameplay::TileType::TILE_FLOOR);
+            }
+        }
+        return map;
+    }
+
+    /**
+     * @brief Field rebuild on a tower of N x N chunks, the target alternating between two far-apart tiles.
+     */
+    void runRebuild(Bench::State &state, Utils::JobSystem *jobs)
+    {
+        const Gameplay::Tilemap map = makeTower((int)state.range());
+        Gameplay::FlowField field;
+        field.build(map, jobs);
+        const float targets[2][2] = {{map.getPixelWidth() * 0.5f, map.getPixelHeight() * 0.5f},
+                                     {map.getPixelWidth() * 0.25f, map.getPixelHeight() * 0.75f}};
+        size_t reached = 0;
+        int next = 0;
+        for (auto _ : state)
+        {
+            Bench::doNotOptimize(field.update(targets[next][0], targets[next][1], jobs));
+            reached += field.getReachedCount();
+            next ^= 1;
+        }
+        state.setItemsProcessed((int64_t)reached);
+    }
+
+    void BM_FlowFieldRebuild(Bench::State &state)
+    {
+        runRebuild(state, nullptr);
+    }
+    BENCHMARK(BM_FlowFieldRebuild)->Arg(16)->Arg(64);
+
+    void BM_FlowFieldRebuildParallel(Bench::State &state)
+    {
+        Utils::JobSystem jobs;
+        runRebuild(state, &jobs);
+    }
+    BENCHMARK(BM_FlowFieldRebuildParallel)->Arg(16)->Arg(64);
+
+    /**
+     * @brief Graph construction (standing tiles, walk, fall and jump links) for a tower of N x N chunks on the worker pool.
+     */
+    void BM_FlowFieldBuild(Bench::State &state)
+    {
+        const Gameplay::Tilemap map = makeTower((int)state.range());
+        Utils::JobSystem jobs;
+        Gameplay::FlowField field;
+        for (auto _ : state)
+        {
+            field.build(map, &jobs);
+            Bench::doNotOptimize(field.getLinkCount());
+        }
+        state.setItemsProcessed((int64_t)(state.iterations() * map.getWidthInTiles() * map.getHeightInTiles()));
+    }
+    BENCHMARK(BM_FlowFieldBuild)->Arg(16)->Arg(64);
+
+    /**
+     * @brief getMove() for N enemy positions scattered over a 64 x 64 chunk tower.
+     */
+    void BM_FlowFieldLookup(Bench::State &state)
+    {
+        const Gameplay::Tilemap map = makeTower(64);
+        Gameplay::FlowField field;
+        field.build(map);
+        field.update(map.getPixelWidth() * 0.5f, map.getPixelHeight() * 0.5f);
+
+        std::vector<float> x((size_t)state.range()), y((size_t)state.range());
+        uint32_t seed = 12345;
+        for (size_t i = 0; i < x.size(); i++)
+        {
+            seed = seed * 1664525u + 1013904223u;
+            x[i] = (float)(seed >> 8) / (float)(1u << 24) * map.getPixelWidth();
+            seed = seed * 1664525u + 1013904223u;
+            y[i] = (float)(seed >> 8) / (float)(1u << 24) * map.getPixelHeight();
+        }
+
+        for (auto _ : state)
+        {
+            uint32_t moves = 0;
+            for (size_t i = 0; i < x.size(); i++)
+                moves += (uint32_t)field.getMove(x[i], y[i]);
+            Bench::doNotOptimize(moves);
+        }
+        state.setItemsProcessed((int64_t)(state.iterations() * state.range()));
+    }
+    BENCHMARK(BM_FlowFieldLookup)->Arg(10000);
+}
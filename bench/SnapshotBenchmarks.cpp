@@ -0,0 +1,140 @@
+#include <cstdint>
+#include <memory>
+
+#include "Benchmark.hpp"
+
+#include "Gameplay/World.hpp"
+#include "Gameplay/WorldSnapshot.hpp"
+
+#include "Common/Constants.hpp"
+#include "Common/Types.hpp"
+
+namespace
+{
+    constexpr int ROLLBACK_FRAMES = 8; // A typical rollback window for late network input
+
+    /**
+     * @brief Test level room holding the player and N enemies dropped at random, stepped until most have landed.
+     */
+    std::unique_ptr<Gameplay::World> makeRoom(size_t enemies)
+    {
+        auto world = std::make_unique<Gameplay::World>();
+        const float width = world->getLevel().getPixelWidth() - Common::TILE_SIZE * 4 - Common::ENEMY_WIDTH;
+        const float height = world->getLevel().getPixelHeight() - Common::TILE_SIZE * 4 - Common::ENEMY_HEIGHT;
+        uint32_t seed = 12345;
+        for (size_t i = 0; i < enemies; i++)
+        {
+            seed = seed * 1664525u + 1013904223u;
+            const float x = Common::TILE_SIZE * 2 + (float)(seed >> 8) / (float)(1u << 24) * width;
+            seed = seed * 1664525u + 1013904223u;
+            const float y = Common::TILE_SIZE * 2 + (float)(seed >> 8) / (float)(1u << 24) * height;
+            world->getEntities().create(Gameplay::EntityKind::ENTITY_ENEMY, x, y, Common::ENEMY_WIDTH, Common::ENEMY_HEIGHT,
+                                        Common::TextureID::TEX_ENEMY);
+        }
+        for (int i = 0; i < 60; i++)
+            world->step(Common::InputState{});
+        return world;
+    }
+
+    // Runs right and fires, so the player moves and projectiles spawn and expire
+    Common::InputState benchInput()
+    {
+        Common::InputState input;
+        input.right = true;
+        input.attack = true;
+        return input;
+    }
+
+    /**
+     * @brief World::saveSnapshot after each step of a room with N enemies.
+     */
+    void BM_WorldSnapshotSave(Bench::State &state)
+    {
+        std::unique_ptr<Gameplay::World> world = makeRoom((size_t)state.range());
+        Gameplay::WorldSnapshot snapshot;
+        for (auto _ : state)
+        {
+            state.pauseTiming();
+            world->step(benchInput());
+            state.resumeTiming();
+
+            world->saveSnapshot(snapshot);
+            Bench::doNotOptimize(snapshot.data());
+        }
+        state.setItemsProcessed((int64_t)(state.iterations() * world->getEntities().size()));
+    }
+    BENCHMARK(BM_WorldSnapshotSave)->Arg(1000)->Arg(10000);
+
+    /**
+     * @brief World::restoreSnapshot of a snapshot taken a step earlier, in a room with N enemies.
+     */
+    void BM_WorldSnapshotRestore(Bench::State &state)
+    {
+        std::unique_ptr<Gameplay::World> world = makeRoom((size_t)state.range());
+        Gameplay::WorldSnapshot snapshot;
+        world->saveSnapshot(snapshot);
+        for (auto _ : state)
+        {
+            state.pauseTiming();
+            world->step(benchInput());
+            state.resumeTiming();
+
+            Bench::doNotOptimize(world->restoreSnapshot(snapshot));
+        }
+        state.setItemsProcessed((int64_t)(state.iterations() * world->getEntities().size()));
+    }
+    BENCHMARK(BM_WorldSnapshotRestore)->Arg(1000)->Arg(10000);
+
+    /**
+     * @brief SnapshotHistory::push of each step's snapshot into a full default-size ring (delta encoding included).
+     */
+    void BM_SnapshotHistoryPush(Bench::State &state)
+    {
+        std::unique_ptr<Gameplay::World> world = makeRoom((size_t)state.range());
+        Gameplay::WorldSnapshot snapshot;
+        Gameplay::SnapshotHistory history;
+        for (size_t i = 0; i < history.capacity(); i++)
+        {
+            world->step(benchInput());
+            world->saveSnapshot(snapshot);
+            history.push(snapshot);
+        }
+
+        for (auto _ : state)
+        {
+            state.pauseTiming();
+            world->step(benchInput());
+            world->saveSnapshot(snapshot);
+            state.resumeTiming();
+
+            history.push(snapshot);
+        }
+        state.setItemsProcessed((int64_t)state.iterations());
+    }
+    BENCHMARK(BM_SnapshotHistoryPush)->Arg(1000)->Arg(10000);
+
+    /**
+     * @brief Rollback of ROLLBACK_FRAMES steps: undo the deltas and restore the world, without the re-simulation.
+     */
+    void BM_WorldRollback(Bench::State &state)
+    {
+        std::unique_ptr<Gameplay::World> world = makeRoom((size_t)state.range());
+        Gameplay::WorldSnapshot snapshot;
+        Gameplay::SnapshotHistory history;
+        for (auto _ : state)
+        {
+            state.pauseTiming();
+            while (history.size() <= (size_t)ROLLBACK_FRAMES)
+            {
+                world->step(benchInput());
+                world->saveSnapshot(snapshot);
+                history.push(snapshot);
+            }
+            state.resumeTiming();
+
+            Bench::doNotOptimize(history.rollBack(ROLLBACK_FRAMES) && world->restoreSnapshot(history.newest()));
+        }
+        state.setItemsProcessed((int64_t)state.iterations());
+    }
+    BENCHMARK(BM_WorldRollback)->Arg(1000)->Arg(10000);
+}
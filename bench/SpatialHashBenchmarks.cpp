@@ -0,0 +1,202 @@
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "Benchmark.hpp"
+
+#include "Gameplay/SpatialHash.hpp"
+
+#include "Common/Constants.hpp"
+
+namespace
+{
+    // Dynamic bodies at constant density: the world grows with the body count, as a bigger level would
+    struct Bodies
+    {
+        std::vector<float> x, y, width, height, velX, velY;
+        float worldSize = 0.0f;
+
+        explicit Bodies(size_t count)
+        {
+            constexpr float AREA_PER_BODY = 64.0f * 64.0f;
+            worldSize = std::sqrt(AREA_PER_BODY * count);
+
+            uint32_t seed = 12345;
+            auto next = [&seed]
+            {
+                seed = seed * 1664525u + 1013904223u;
+                return (float)(seed >> 8) / (float)(1u << 24);
+            };
+            for (size_t i = 0; i < count; i++)
+            {
+                x.push_back(next() * worldSize);
+                y.push_back(next() * worldSize);
+                width.push_back(10.0f + next() * 40.0f);
+                height.push_back(10.0f + next() * 40.0f);
+                velX.push_back((next() - 0.5f) * 400.0f);
+                velY.push_back((next() - 0.5f) * 400.0f);
+            }
+        }
+
+        // Moves every body one step, wrapping around the world edges
+        void step()
+        {
+            for (size_t i = 0; i < x.size(); i++)
+            {
+                x[i] += velX[i] * Common::TIME_STEP;
+                y[i] += velY[i] * Common::TIME_STEP;
+                if (x[i] < 0.0f)
+                    x[i] += worldSize;
+                else if (x[i] > worldSize)
+                    x[i] -= worldSize;
+                if (y[i] < 0.0f)
+                    y[i] += worldSize;
+                else if (y[i] > worldSize)
+                    y[i] -= worldSize;
+            }
+        }
+    };
+
+    constexpr size_t HASH_CHECK_BODIES = 2000;  // Bodies compared against brute force before BM_SpatialHashTick
+    constexpr size_t HASH_CHECK_LARGE_EVERY = 16; // Every n-th body spans several cells
+    constexpr int HASH_CHECK_STEPS = 3;           // Builds checked, moving the bodies in between
+
+    /**
+     * @brief Sorted indices of the bodies `test` accepts, by testing every body.
+     */
+    template <typename Test>
+    std::vector<uint32_t> bruteForce(const Bodies &bodies, const Test &test)
+    {
+        std::vector<uint32_t> found;
+        for (size_t i = 0; i < bodies.x.size(); i++)
+        {
+            if (test(bodies.x[i], bodies.y[i], bodies.width[i], bodies.height[i]))
+                found.push_back((uint32_t)i);
+        }
+        return found;
+    }
+
+    /**
+     * @brief Whether AABB and radius queries return exactly the brute-force matches, for boxes from a few pixels to several cells wide.
+     *
+     * Every body queries its own box and a radius around its corner, with query sizes mixed the same way.
+     */
+    bool spatialHashMatchesBruteForce()
+    {
+        Bodies bodies(HASH_CHECK_BODIES);
+        for (size_t i = 0; i < bodies.x.size(); i += HASH_CHECK_LARGE_EVERY)
+        {
+            bodies.width[i] *= 8.0f;
+            bodies.height[i] *= 5.0f;
+        }
+
+        Gameplay::SpatialHash hash;
+        std::vector<uint32_t> results(bodies.x.size()); // Room for every body, so no query is cut short
+        for (int step = 0; step < HASH_CHECK_STEPS; step++)
+        {
+            bodies.step();
+            hash.build(bodies.x.data(), bodies.y.data(), bodies.width.data(), bodies.height.data(), bodies.x.size());
+            for (size_t i = 0; i < bodies.x.size(); i++)
+            {
+                const Gameplay::AABB box = {bodies.x[i], bodies.y[i], bodies.width[i], bodies.height[i]};
+                std::vector<uint32_t> found(results.begin(), results.begin() + hash.queryAABB(box, results.data(), results.size()));
+                std::sort(found.begin(), found.end());
+                const std::vector<uint32_t> overlapping = bruteForce(bodies, [&](float x, float y, float width, float height)
+                                                                     { return x < box.x + box.width && x + width > box.x &&
+                                                                              y < box.y + box.height && y + height > box.y; });
+                if (found != overlapping)
+                    return false;
+
+                const float radius = bodies.width[i];
+                found.assign(results.begin(), results.begin() + hash.queryRadius(box.x, box.y, radius, results.data(), results.size()));
+                std::sort(found.begin(), found.end());
+                const std::vector<uint32_t> near = bruteForce(bodies, [&](float x, float y, float width, float height)
+                                                              {
+                                                                  const float dx = box.x - std::clamp(box.x, x, x + width);
+                                                                  const float dy = box.y - std::clamp(box.y, y, y + height);
+                                                                  return dx * dx + dy * dy <= radius * radius; });
+                if (found != near)
+                    return false;
+            }
+        }
+        return true;
+    }
+
+    /**
+     * @brief Rebuilds the hash over N moving bodies; time per body should stay flat as N grows.
+     */
+    void BM_SpatialHashBuild(Bench::State &state)
+    {
+        Bodies bodies((size_t)state.range());
+        Gameplay::SpatialHash hash;
+        for (auto _ : state)
+        {
+            state.pauseTiming();
+            bodies.step();
+            state.resumeTiming();
+
+            hash.build(bodies.x.data(), bodies.y.data(), bodies.width.data(), bodies.height.data(), bodies.x.size());
+            Bench::clobberMemory();
+        }
+        state.setItemsProcessed((int64_t)(state.iterations() * bodies.x.size()));
+    }
+    BENCHMARK(BM_SpatialHashBuild)->Arg(1000)->Arg(10000)->Arg(50000);
+
+    /**
+     * @brief One full broad-phase tick: rebuild, then every body queries the area around itself.
+     *
+     * Fails instead of timing if the queries disagree with a brute-force search.
+     */
+    void BM_SpatialHashTick(Bench::State &state)
+    {
+        if (!spatialHashMatchesBruteForce())
+        {
+            state.failWithError("queries differ from a brute-force search");
+            return;
+        }
+
+        Bodies bodies((size_t)state.range());
+        Gameplay::SpatialHash hash;
+        uint32_t results[256];
+        size_t pairs = 0;
+        for (auto _ : state)
+        {
+            state.pauseTiming();
+            bodies.step();
+            state.resumeTiming();
+
+            hash.build(bodies.x.data(), bodies.y.data(), bodies.width.data(), bodies.height.data(), bodies.x.size());
+            for (size_t i = 0; i < bodies.x.size(); i++)
+            {
+                const Gameplay::AABB box = {bodies.x[i], bodies.y[i], bodies.width[i], bodies.height[i]};
+                pairs += hash.queryAABB(box, results, 256);
+            }
+        }
+        Bench::doNotOptimize(pairs);
+        state.setItemsProcessed((int64_t)(state.iterations() * bodies.x.size()));
+    }
+    BENCHMARK(BM_SpatialHashTick)->Arg(1000)->Arg(10000)->Arg(50000);
+
+    /**
+     * @brief Radius and ray queries of attack size against 10k bodies.
+     */
+    void BM_SpatialHashAttackQueries(Bench::State &state)
+    {
+        Bodies bodies(10000);
+        Gameplay::SpatialHash hash;
+        hash.build(bodies.x.data(), bodies.y.data(), bodies.width.data(), bodies.height.data(), bodies.x.size());
+
+        uint32_t results[256];
+        size_t query = 0;
+        for (auto _ : state)
+        {
+            const size_t i = query++ % bodies.x.size();
+            Bench::doNotOptimize(hash.queryRadius(bodies.x[i], bodies.y[i], 96.0f, results, 256));
+            Bench::doNotOptimize(hash.queryRay(bodies.x[i], bodies.y[i], 1.0f, 0.0f, 256.0f, results, 256));
+        }
+        state.setItemsProcessed((int64_t)state.iterations() * 2);
+    }
+    BENCHMARK(BM_SpatialHashAttackQueries);
+}
@@ -0,0 +1,105 @@
+#include <atomic>
+#include <cstdint>
+#include <thread>
+#include <vector>
+
+#include "Benchmark.hpp"
+
+#include "Engine/AssetStreamer.hpp"
+#include "Engine/CpuRenderer.hpp"
+
+#include "Utils/FrameArena.hpp"
+#include "Utils/MpscQueue.hpp"
+
+#include "Common/Constants.hpp"
+#include "Common/Types.hpp"
+
+namespace
+{
+    constexpr size_t QUEUE_TRANSFERS = 1 << 16;     // Values the consumer takes per iteration
+    constexpr int STREAM_BENCH_CHUNKS = 64;         // Synthetic level side, in chunks
+    constexpr size_t STREAM_BENCH_CHUNK_TILES = 512; // Commands per synthetic chunk (half the tiles solid)
+
+    /**
+     * @brief Utils::MpscQueue hand-off from N producer threads to the benchmark thread, QUEUE_TRANSFERS values per iteration.
+     */
+    void BM_MpscQueueTransfer(Bench::State &state)
+    {
+        const int producers = (int)state.range();
+        Utils::MpscQueue<uint64_t> queue(Engine::STREAM_COMPLETION_CAPACITY);
+        for (auto _ : state)
+        {
+            std::atomic<size_t> claimed{0};
+            std::vector<std::thread> threads;
+            for (int i = 0; i < producers; i++)
+            {
+                threads.emplace_back([&queue, &claimed]
+                                     {
+                    while (claimed.fetch_add(1, std::memory_order_relaxed) < QUEUE_TRANSFERS)
+                    {
+                        uint64_t value = 1;
+                        while (!queue.tryPush(value))
+                            std::this_thread::yield();
+                    } });
+            }
+
+            uint64_t sum = 0;
+            uint64_t value;
+            for (size_t received = 0; received < QUEUE_TRANSFERS;)
+            {
+                if (queue.tryPop(value))
+                {
+                    sum += value;
+                    received++;
+                }
+                else
+                {
+                    std::this_thread::yield();
+                }
+            }
+            for (std::thread &thread : threads)
+                thread.join();
+            Bench::doNotOptimize(sum);
+        }
+        state.setItemsProcessed((int64_t)(state.iterations() * QUEUE_TRANSFERS));
+    }
+    BENCHMARK(BM_MpscQueueTransfer)->Arg(1)->Arg(4);
+
+    /**
+     * @brief Main-thread cost of AssetStreamer::update() plus one resident-chunk copy per frame,
+     * with the focus crossing a chunk every N frames of a synthetic level.
+     */
+    void BM_AssetStreamerUpdate(Bench::State &state)
+    {
+        const float pixelsPerFrame = (float)Common::CHUNK_PIXELS / (float)state.range();
+        Engine::CpuRenderer renderer(nullptr, nullptr);
+        Engine::AssetStreamer streamer(Engine::STREAM_THREAD_COUNT, Engine::STREAM_DEFAULT_MEMORY_CAP);
+        streamer.setChunkSource([](int chunkX, int chunkY, Utils::FrameVector<Common::RenderCommand> &out)
+                                {
+            out.resize(STREAM_BENCH_CHUNK_TILES);
+            for (size_t i = 0; i < out.size(); i++)
+            {
+                out[i].x = (float)((i * 2) % Common::CHUNK_SIZE * Common::TILE_SIZE);
+                out[i].y = (float)((i * 2) / Common::CHUNK_SIZE * Common::TILE_SIZE);
+                out[i].textureID = (chunkX + chunkY) % 2 ? Common::TextureID::TEX_WALL : Common::TextureID::TEX_FLOOR;
+            } },
+                                STREAM_BENCH_CHUNKS, STREAM_BENCH_CHUNKS);
+
+        const float levelPixels = (float)(STREAM_BENCH_CHUNKS * Common::CHUNK_PIXELS);
+        Common::StreamFocus focus{0.0f, levelPixels / 2, pixelsPerFrame * 60.0f, 0.0f};
+        Utils::FrameVector<Common::RenderCommand> commands;
+        for (auto _ : state)
+        {
+            focus.x += pixelsPerFrame;
+            if (focus.x >= levelPixels)
+                focus.x = 0.0f;
+
+            streamer.update(focus, renderer);
+            commands.clear();
+            streamer.copyChunk((int)(focus.x / Common::CHUNK_PIXELS), (int)(focus.y / Common::CHUNK_PIXELS), commands);
+            Bench::doNotOptimize(commands.data());
+        }
+        state.setItemsProcessed((int64_t)state.iterations());
+    }
+    BENCHMARK(BM_AssetStreamerUpdate)->Arg(4)->Arg(60);
+}
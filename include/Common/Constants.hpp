@@ -8,20 +8,39 @@ namespace Common
     inline constexpr int MINIMUM_SCREEN_WIDTH = 854;
     inline constexpr int MINIMUM_SCREEN_HEIGHT = 480;
     inline constexpr const char *WINDOW_TITLE_PREFIX = "2D Roguelike-Metroidvania v0.0.1 | FPS: ";
+    inline constexpr float FRAME_RATE_CAP = 0.0f;         // Default for --fps-cap; 0 renders uncapped
+    inline constexpr float FPS_TITLE_REFRESH_TIME = 1.0f; // Seconds between window title updates
 
     // --- Player Settings ---
     inline constexpr float PLAYER_WIDTH = 50.0f;
     inline constexpr float PLAYER_HEIGHT = 50.0f;
+    inline constexpr float ATTACK_COOLDOWN = 0.2f; // Seconds between shots
+
+    // --- Enemy & Projectile Settings ---
+    inline constexpr float ENEMY_WIDTH = 40.0f;
+    inline constexpr float ENEMY_HEIGHT = 40.0f;
+    inline constexpr float ENEMY_SPEED = 120.0f;
+    inline constexpr float ENEMY_ACCELERATION = 2000.0f;
+    inline constexpr float ENEMY_FRICTION = 4000.0f;
+    inline constexpr float ENEMY_JUMP_FORCE = -500.0f; // Used on the jump links of the flow field (about four tiles high)
+    inline constexpr float PROJECTILE_SIZE = 10.0f;
+    inline constexpr float PROJECTILE_SPEED = 900.0f;
+    inline constexpr float PROJECTILE_LIFETIME = 1.5f;
+    inline constexpr int ENTITY_RESERVE = 16384; // Entities pre-allocated per world
+    inline constexpr int PARTICLE_CAPACITY = 131072; // Live particles per world; further emissions are dropped
 
     // --- Physics & Gameplay Logic ---
     inline constexpr float TARGET_FPS = 60.0f;
     inline constexpr float TIME_STEP = 1.0f / TARGET_FPS;
+    inline constexpr float MAX_FRAME_TIME = 0.25f;   // Longest real frame fed to the accumulator
+    inline constexpr int MAX_STEPS_PER_FRAME = 8;    // Spiral-of-death guard
     inline constexpr float GRAVITY = 980.0f;
     inline constexpr float TERMINAL_VELOCITY = 5399.8f;
     inline constexpr float PLAYER_ACCELERATION = 5000.0f;
     inline constexpr float FRICTION = 10000.0f;
     inline constexpr float JUMP_FORCE = -500.0f;
     inline constexpr float PLAYER_MAX_SPEED = 500.0f;
+    inline constexpr int SNAPSHOT_HISTORY_FRAMES = 120; // World snapshots kept for rewind and rollback (two seconds of steps)
 
     // --- Texture & Sprite IDs ---
     enum class TextureID : int
@@ -30,10 +49,46 @@ namespace Common
         TEX_WALL = 1,
         TEX_FLOOR = 2,
         TEX_ENEMY = 3,
+        TEX_PROJECTILE = 4,
         TEX_COUNT,
         TEXT_NONE = -1
     };
 
+    // --- Asset Paths (relative to the executable, indexed by TextureID) ---
+    inline constexpr const char *TEXTURE_PATHS[] = {
+        "assets/sprites/player.bmp",
+        "assets/sprites/wall.bmp",
+        "assets/sprites/floor.bmp",
+        "assets/sprites/enemy.bmp",
+        "assets/sprites/projectile.bmp",
+    };
+    static_assert(sizeof(TEXTURE_PATHS) / sizeof(TEXTURE_PATHS[0]) == (int)TextureID::TEX_COUNT);
+
+    // --- Sound IDs ---
+    enum class SoundID : int
+    {
+        SOUND_SHOOT = 0,
+        SOUND_HIT = 1,
+        SOUND_LAND = 2,
+        SOUND_COUNT
+    };
+
+    // --- Sound Paths (relative to the executable, indexed by SoundID) ---
+    inline constexpr const char *SOUND_PATHS[] = {
+        "assets/audio/shoot.wav",
+        "assets/audio/hit.wav",
+        "assets/audio/land.wav",
+    };
+    static_assert(sizeof(SOUND_PATHS) / sizeof(SOUND_PATHS[0]) == (int)SoundID::SOUND_COUNT);
+    inline constexpr float SOUND_PAN_DISTANCE = SCREEN_WIDTH * 0.5f; // Pixels beside the player at which a sound is panned fully to one side
+
     // --- Tile/Grid Settings ---
     inline constexpr int TILE_SIZE = 32;
+    inline constexpr int CHUNK_SIZE = 32; // Tiles per chunk side
+    inline constexpr int CHUNK_PIXELS = CHUNK_SIZE * TILE_SIZE;
+    inline constexpr int SPATIAL_CELL_SIZE = 2 * TILE_SIZE; // Broad-phase grid cell; about one entity across
+
+    // --- Render Layers (lower is drawn first) ---
+    inline constexpr int LAYER_TILES = 0;
+    inline constexpr int LAYER_ENTITIES = 1;
 }
\ No newline at end of file
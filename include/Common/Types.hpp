@@ -1,5 +1,7 @@
 #pragma once
 
+#include <cstdint>
+
 #include "Common/Constants.hpp"
 
 namespace Common
@@ -23,5 +25,38 @@ namespace Common
         float x = 0.0f, y = 0.0f;
         float width = 0.0f, height = 0.0f;
         Common::TextureID textureID = Common::TextureID::TEXT_NONE;
+        int layer = 0; // Lower layers are drawn first
+        // Source rectangle within the sprite, normalized to [0, 1] (e.g. one animation frame)
+        float u0 = 0.0f, v0 = 0.0f, u1 = 1.0f, v1 = 1.0f;
+    };
+
+    // Instruction from Gameplay to Engine: draw the cached static layer of one tilemap chunk
+    struct StaticChunkCommand
+    {
+        int chunkX = 0, chunkY = 0;
+        uint32_t version = 0; // Changes whenever the chunk's tiles change; a stale cache entry is rebuilt
+        float x = 0.0f, y = 0.0f; // Screen-space top-left corner; the chunk is Common::CHUNK_PIXELS square
+    };
+
+    // Instruction from Gameplay to Engine: where the player is and where it is heading, so assets ahead of it stream in first
+    struct StreamFocus
+    {
+        float x = 0.0f, y = 0.0f;       // World-space center
+        float velX = 0.0f, velY = 0.0f; // Pixels per second
+    };
+
+    // Instruction from Gameplay to Engine: one untextured square particle, drawn in a single batch with the others
+    struct ParticleInstance
+    {
+        float x = 0.0f, y = 0.0f; // Screen-space top-left corner
+        float size = 0.0f;
+        uint32_t color = 0xFFFFFFFF; // 0xRRGGBBAA
+    };
+
+    // Instruction from Gameplay to Engine: play a one-shot sound for something that happened during a step
+    struct SoundEvent
+    {
+        Common::SoundID sound = Common::SoundID::SOUND_SHOOT;
+        float pan = 0.0f; // -1 is hard left, 1 hard right (where it happened relative to the player)
     };
 }
\ No newline at end of file
@@ -0,0 +1,182 @@
+#pragma once
+#include <SDL3/SDL.h>
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+#include "Common/Types.hpp"
+#include "Engine/Renderer.hpp"
+#include "Utils/FrameArena.hpp"
+#include "Utils/MpscQueue.hpp"
+
+namespace Engine
+{
+    // I/O threads; loads mostly wait on the disk, so a couple are enough to keep it busy
+    inline constexpr unsigned STREAM_THREAD_COUNT = 2;
+    // Finished loads waiting for the main thread; I/O threads hold on to their result while it is full
+    inline constexpr size_t STREAM_COMPLETION_CAPACITY = 256;
+    // Chunks kept resident around the streaming center, per side (a 5x5 square)
+    inline constexpr int STREAM_RADIUS_CHUNKS = 2;
+    // The streaming center leads the player by this much of its velocity, in seconds
+    inline constexpr float STREAM_LOOKAHEAD_SECONDS = 0.75f;
+    // Pixels of distance a chunk straight ahead of the player gains over one to the side, per pixel ahead
+    inline constexpr float STREAM_DIRECTION_WEIGHT = 0.5f;
+    // Default cap on decoded chunk data kept resident
+    inline constexpr size_t STREAM_DEFAULT_MEMORY_CAP = 16 * 1024 * 1024;
+    // Main-thread time spent handing finished loads over per frame
+    inline constexpr uint64_t STREAM_FRAME_BUDGET_NS = 2'000'000;
+
+    // Running totals since the streamer was created, plus the current residency
+    struct StreamingStats
+    {
+        uint64_t texturesLoaded = 0;
+        uint64_t chunksLoaded = 0;
+        uint64_t chunksEvicted = 0;
+        uint64_t chunksCancelled = 0; // Queued requests dropped because the player moved away first
+        size_t residentChunks = 0;
+        size_t residentBytes = 0;
+        size_t peakResidentBytes = 0;
+    };
+
+    /**
+     * @brief Loads textures and level chunks on background I/O threads around where the player is heading.
+     *
+     * Requests wait in a shared list; each I/O thread takes the most urgent one when it is free,
+     * so priorities always reflect the latest focus: textures first, then chunks by distance from
+     * the player, with chunks in the direction of travel pulled ahead. Finished loads come back
+     * through a lock-free queue that the main thread drains in update() within a time budget.
+     * Decoded chunks stay resident until the memory cap forces out the least recently used ones.
+     *
+     * Everything except the I/O threads themselves runs on the main thread.
+     */
+    class AssetStreamer
+    {
+    public:
+        /**
+         * @brief Starts `threadCount` I/O threads.
+         *
+         * @param memoryCap Bytes of decoded chunk data kept resident before least recently used chunks are evicted.
+         */
+        AssetStreamer(unsigned threadCount, size_t memoryCap);
+
+        /**
+         * @brief Stops the I/O threads, waiting for loads in progress, and frees undelivered results.
+         */
+        ~AssetStreamer();
+
+        AssetStreamer(const AssetStreamer &) = delete;
+        AssetStreamer &operator=(const AssetStreamer &) = delete;
+
+        /**
+         * @brief Queues a BMP sprite; it is handed to the renderer by a later update().
+         */
+        void requestTexture(Common::TextureID id, std::string path);
+
+        /**
+         * @brief Sets how a chunk is decoded: `source` is called on the I/O threads and must be safe to call concurrently.
+         *
+         * Call before the first update(); the streamer must be destroyed before whatever `source` reads from.
+         */
+        void setChunkSource(StaticChunkSource source, int widthInChunks, int heightInChunks);
+
+        /**
+         * @brief Per-frame step: requests the chunks around `focus`, hands finished loads over, evicts over the cap.
+         *
+         * Textures go to `renderer` (followed by one buildAtlas() if any arrived). At least one
+         * finished load is handled even when the budget is already spent.
+         *
+         * @return int Finished loads handled this call.
+         */
+        int update(const Common::StreamFocus &focus, Renderer &renderer, uint64_t budgetNs = STREAM_FRAME_BUDGET_NS);
+
+        /**
+         * @brief Appends a resident chunk's commands (chunk-local, like StaticChunkSource) and marks it used.
+         *
+         * @return false, with `out` untouched, if the chunk is not resident; the caller decodes it itself.
+         */
+        bool copyChunk(int chunkX, int chunkY, Utils::FrameVector<Common::RenderCommand> &out);
+
+        /**
+         * @brief Drops every resident chunk and discards loads already under way, e.g. after the level changed.
+         */
+        void invalidateChunks();
+
+        const StreamingStats &getStats() const { return m_stats; }
+
+    private:
+        enum class RequestKind : uint8_t
+        {
+            REQUEST_TEXTURE,
+            REQUEST_CHUNK
+        };
+
+        struct Request
+        {
+            RequestKind kind = RequestKind::REQUEST_CHUNK;
+            Common::TextureID texture = Common::TextureID::TEXT_NONE;
+            std::string path;
+            int chunkX = 0, chunkY = 0;
+            uint32_t generation = 0; // Chunk generation when requested
+        };
+
+        struct Completion
+        {
+            RequestKind kind = RequestKind::REQUEST_CHUNK;
+            Common::TextureID texture = Common::TextureID::TEXT_NONE;
+            SDL_Surface *surface = nullptr; // Owned; nullptr if the load failed
+            int chunkX = 0, chunkY = 0;
+            uint32_t generation = 0;
+            Utils::FrameVector<Common::RenderCommand> commands; // Heap-backed; moved into the cache
+        };
+
+        struct ResidentChunk
+        {
+            Utils::FrameVector<Common::RenderCommand> commands;
+            size_t bytes = 0;
+            uint64_t lastUsedFrame = 0;
+        };
+
+        static uint64_t chunkKey(int chunkX, int chunkY) { return ((uint64_t)(uint32_t)chunkY << 32) | (uint32_t)chunkX; }
+
+        void workerLoop();
+
+        /**
+         * @brief Removes and returns the most urgent pending request; m_mutex must be held.
+         */
+        Request takeMostUrgent();
+
+        /**
+         * @brief Queues the chunks around the focus that are neither resident nor requested, and drops requests that left the area.
+         */
+        void requestAround(const Common::StreamFocus &focus);
+        void evictOverCap();
+
+        StaticChunkSource m_chunkSource;
+        int m_widthInChunks = 0;
+        int m_heightInChunks = 0;
+        size_t m_memoryCap;
+
+        // Shared with the I/O threads
+        std::mutex m_mutex;
+        std::condition_variable m_wake;
+        std::vector<Request> m_pending;  // Guarded by m_mutex
+        Common::StreamFocus m_focus{};   // Guarded by m_mutex; what the I/O threads prioritize by
+        std::atomic<bool> m_running{true};
+        Utils::MpscQueue<Completion> m_completions{STREAM_COMPLETION_CAPACITY};
+        std::vector<std::thread> m_threads;
+
+        // Main thread only
+        std::unordered_map<uint64_t, ResidentChunk> m_resident;
+        std::unordered_set<uint64_t> m_requested; // Chunks queued or being loaded
+        uint32_t m_generation = 0;                // Bumped by invalidateChunks(); older results are discarded
+        uint64_t m_frame = 0;
+        StreamingStats m_stats;
+    };
+} // namespace Engine
@@ -0,0 +1,230 @@
+#pragma once
+#include <SDL3/SDL.h>
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+
+#include "Common/Constants.hpp"
+#include "Utils/Simd.hpp"
+#include "Utils/SpscQueue.hpp"
+
+namespace Engine
+{
+    // Output format: interleaved stereo floats; the audio stream converts to whatever the device wants
+    inline constexpr int AUDIO_SAMPLE_RATE = 48000;
+    inline constexpr int AUDIO_CHANNELS = 2;
+    // Sample frames per device buffer asked of SDL (about 5.3 ms at AUDIO_SAMPLE_RATE); the driver may round it
+    inline constexpr int AUDIO_DEVICE_FRAMES = 256;
+    // Voices mixed at once; a play() beyond that takes over the voice closest to finishing
+    inline constexpr int AUDIO_MAX_VOICES = 128;
+    // Frames mixed per pass over the voices; volume changes ramp over one block
+    inline constexpr size_t AUDIO_BLOCK_FRAMES = 256;
+    // Commands the game thread can queue between two audio callbacks
+    inline constexpr size_t AUDIO_COMMAND_CAPACITY = 1024;
+    // Default size of the PCM pool every sound is stored in: 30 seconds of mono samples
+    inline constexpr size_t AUDIO_DEFAULT_POOL_FRAMES = (size_t)AUDIO_SAMPLE_RATE * 30;
+    // Gain applied to the sum of all voices before it is clipped to [-1, 1]
+    inline constexpr float AUDIO_MASTER_VOLUME = 0.5f;
+
+    // Identifies one play() for stop() and setVolume(); never reused within a session
+    using VoiceHandle = uint32_t;
+    inline constexpr VoiceHandle NO_VOICE = 0;
+
+    // Running totals since the mixer was created; the voice counts are as of the last mixed block
+    struct AudioStats
+    {
+        uint64_t framesMixed = 0;
+        uint64_t voicesStolen = 0;    // Voices cut off because all AUDIO_MAX_VOICES were busy
+        uint64_t commandsDropped = 0; // play/stop/volume calls lost to a full command queue
+        int activeVoices = 0;
+        int peakVoices = 0;
+    };
+
+    /**
+     * @brief Adds `count` mono samples into planar stereo accumulators with per-channel gains ramping linearly.
+     *
+     * Sample i is scaled by `gainLeft + stepLeft * i` (and likewise on the right). Runs the widest
+     * supported vector loop, then finishes the remainder with the scalar loop.
+     */
+    void mixMonoVoice(Utils::SimdLevel level, float *left, float *right, const float *samples, size_t count,
+                      float gainLeft, float gainRight, float stepLeft, float stepRight);
+
+    /**
+     * @brief Writes planar stereo as interleaved frames, scaled by `volume` and clipped to [-1, 1].
+     */
+    void interleaveStereo(Utils::SimdLevel level, float *out, const float *left, const float *right, size_t count, float volume);
+
+    /**
+     * @brief Mixes up to AUDIO_MAX_VOICES voices of preloaded sounds on SDL's audio thread.
+     *
+     * Sounds are mono AUDIO_SAMPLE_RATE floats appended to one PCM pool allocated up front, so
+     * adding a sound never moves the ones the audio thread is reading. The game thread drives
+     * playback with play(), stop() and setVolume(), which only push a command into a lock-free
+     * single-producer queue; the audio thread applies the queued commands at the start of each
+     * callback and mixes. Neither thread ever waits for the other, and the audio thread neither
+     * locks nor allocates.
+     *
+     * Output latency is about one device buffer: open() asks SDL for AUDIO_DEVICE_FRAMES frames
+     * per buffer and the callback only mixes what the device asks for, so nothing queues up ahead
+     * of it. Without open(), mix() renders offline into a buffer on the calling thread instead
+     * (benchmarks, or checking output without any audio device).
+     *
+     * Everything except mix() belongs to one game thread.
+     */
+    class AudioMixer
+    {
+    public:
+        /**
+         * @brief Allocates the PCM pool; nothing is opened yet.
+         *
+         * @param poolFrames Mono samples the pool holds across all sounds.
+         * @param level Instruction set of the mix kernels, lowered to what the CPU supports.
+         */
+        explicit AudioMixer(size_t poolFrames = AUDIO_DEFAULT_POOL_FRAMES, Utils::SimdLevel level = Utils::detectSimdLevel());
+
+        /**
+         * @brief Closes the device if open().
+         */
+        ~AudioMixer();
+
+        AudioMixer(const AudioMixer &) = delete;
+        AudioMixer &operator=(const AudioMixer &) = delete;
+
+        /**
+         * @brief Initializes SDL's audio subsystem and starts mixing on the default playback device.
+         *
+         * The driver is SDL's choice unless SDL_HINT_AUDIO_DRIVER was set beforehand (e.g. "dummy").
+         *
+         * @return false (after logging) if there is no usable device; the game then runs silent.
+         */
+        bool open();
+
+        /**
+         * @brief Stops the audio thread and releases the device and the audio subsystem.
+         */
+        void close();
+
+        bool isOpen() const { return m_stream != nullptr; }
+
+        /**
+         * @brief Copies `frames` mono AUDIO_SAMPLE_RATE samples into the pool as sound `id`.
+         *
+         * A sound already playing keeps its old samples; later plays use the new ones.
+         *
+         * @return false (after logging) if the pool is out of space.
+         */
+        bool addSound(Common::SoundID id, const float *samples, size_t frames);
+
+        /**
+         * @brief Loads a WAV file, converted to mono AUDIO_SAMPLE_RATE floats, as sound `id`.
+         *
+         * @return true if the file was loaded, false otherwise (the slot gets a synthesized fallback tone).
+         */
+        bool loadSound(Common::SoundID id, const std::string &path);
+
+        /**
+         * @brief Starts sound `id`; `pan` runs from -1 (left) to 1 (right).
+         *
+         * @return Handle for stop() and setVolume(), or NO_VOICE if the sound is empty or the command queue is full.
+         */
+        VoiceHandle play(Common::SoundID id, float volume = 1.0f, float pan = 0.0f, bool loop = false);
+
+        /**
+         * @brief Fades a voice out over one block; does nothing if it already finished.
+         */
+        void stop(VoiceHandle voice);
+
+        /**
+         * @brief Ramps a voice to `volume` over one block; does nothing if it already finished.
+         */
+        void setVolume(VoiceHandle voice, float volume);
+
+        /**
+         * @brief Applies queued commands, then writes `frames` interleaved stereo frames to `out`.
+         *
+         * Called by the audio thread while open(); otherwise it may be called by any one thread
+         * at a time to render offline.
+         */
+        void mix(float *out, size_t frames);
+
+        AudioStats getStats() const;
+
+        /**
+         * @brief Frames per device buffer granted by the driver; 0 until open() succeeds.
+         */
+        int getDeviceFrames() const { return m_deviceFrames; }
+
+    private:
+        enum class CommandKind : uint8_t
+        {
+            COMMAND_PLAY,
+            COMMAND_STOP,
+            COMMAND_SET_VOLUME
+        };
+
+        // Game thread to audio thread; a play carries the sound's place in the pool, so the audio thread never reads the sound table
+        struct Command
+        {
+            CommandKind kind = CommandKind::COMMAND_PLAY;
+            VoiceHandle voice = NO_VOICE;
+            uint32_t offset = 0, frames = 0;
+            float volume = 1.0f, pan = 0.0f;
+            bool loop = false;
+        };
+
+        // Audio thread only
+        struct Voice
+        {
+            VoiceHandle handle = NO_VOICE; // NO_VOICE marks a free voice
+            uint32_t offset = 0, frames = 0, position = 0;
+            float volume = 1.0f, pan = 0.0f;
+            float gainLeft = 0.0f, gainRight = 0.0f; // Gains reached at the end of the last block
+            bool loop = false;
+            bool stopping = false; // Fading out over the next block, then freed
+        };
+
+        // Game thread only
+        struct SoundSlot
+        {
+            uint32_t offset = 0, frames = 0;
+        };
+
+        static void SDLCALL streamCallback(void *userdata, SDL_AudioStream *stream, int additionalAmount, int totalAmount);
+
+        bool push(Command &command);
+        void applyCommands();
+        void startVoice(const Command &command);
+        Voice *findVoice(VoiceHandle handle);
+        void mixBlock(size_t frames);
+
+        const Utils::SimdLevel m_level;
+
+        // PCM pool: written by the game thread past m_poolUsed only, read by the audio thread below it
+        std::unique_ptr<float[]> m_pool;
+        size_t m_poolFrames = 0;
+        size_t m_poolUsed = 0;
+        std::array<SoundSlot, (size_t)Common::SoundID::SOUND_COUNT> m_sounds{};
+
+        Utils::SpscQueue<Command> m_commands;
+        VoiceHandle m_nextHandle = 1;
+        uint64_t m_commandsDropped = 0;
+
+        // Audio thread state
+        std::array<Voice, AUDIO_MAX_VOICES> m_voices{};
+        alignas(32) float m_left[AUDIO_BLOCK_FRAMES];
+        alignas(32) float m_right[AUDIO_BLOCK_FRAMES];
+        alignas(32) float m_output[AUDIO_BLOCK_FRAMES * AUDIO_CHANNELS]; // Callback staging for SDL_PutAudioStreamData
+
+        // Written by the audio thread, read by getStats()
+        std::atomic<uint64_t> m_framesMixed{0};
+        std::atomic<uint64_t> m_voicesStolen{0};
+        std::atomic<int> m_activeVoices{0};
+        std::atomic<int> m_peakVoices{0};
+
+        SDL_AudioStream *m_stream = nullptr;
+        int m_deviceFrames = 0;
+    };
+} // namespace Engine
@@ -0,0 +1,110 @@
+#pragma once
+#include <SDL3/SDL.h>
+#include <array>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "Common/Constants.hpp"
+#include "Common/Types.hpp"
+#include "Engine/Rasterizer.hpp"
+#include "Engine/Renderer.hpp"
+#include "Utils/FrameArena.hpp"
+
+namespace Utils
+{
+    class JobSystem;
+}
+
+namespace Engine
+{
+    // Side of the square framebuffer tiles rasterized as independent jobs
+    inline constexpr int RASTER_TILE_SIZE = 64;
+
+    /**
+     * @brief Renderer backend that rasterizes on the CPU into a Common::SCREEN_WIDTH x SCREEN_HEIGHT framebuffer.
+     *
+     * Draw calls only record clipped rectangles (solid, blended or sprite-mapped). endFrame() bins
+     * them into RASTER_TILE_SIZE tiles, rasterizes the tiles in parallel with SIMD span kernels,
+     * painting each tile's primitives in submission order, and uploads the frame to a streaming
+     * texture. Sprites are sampled nearest-neighbour from premultiplied copies.
+     *
+     * Static chunks are not cached: their tiles are rasterized every frame, which costs about what
+     * copying a cached chunk image would.
+     */
+    class CpuRenderer final : public Renderer
+    {
+    public:
+        /**
+         * @brief Allocates the framebuffer and, if `window` is given, an SDL renderer and streaming texture to present with.
+         *
+         * @param jobs Worker pool for tile rasterization; nullptr rasterizes on the calling thread.
+         */
+        CpuRenderer(SDL_Window *window, Utils::JobSystem *jobs);
+        ~CpuRenderer() override;
+
+        bool addTexture(Common::TextureID id, SDL_Surface *surface) override;
+        int buildAtlas() override;
+        void beginFrame() override;
+        void drawStaticChunks(const Utils::FrameVector<Common::StaticChunkCommand> &chunks) override;
+        void invalidateStaticCache() override {}
+        void drawCommands(const Utils::FrameVector<Common::RenderCommand> &commands) override;
+        void drawParticles(const Utils::FrameVector<Common::ParticleInstance> &particles) override;
+        void endFrame() override;
+
+        /**
+         * @brief Last finished frame as rasterizer pixels (see Engine/Rasterizer.hpp), SCREEN_WIDTH pixels per row.
+         */
+        const uint32_t *getPixels() const { return m_framebuffer.data(); }
+
+    private:
+        struct Sprite
+        {
+            int width = 0, height = 0;
+            bool opaque = false; // Every pixel has alpha 255, so rows are copied instead of blended
+            std::vector<uint32_t> pixels;
+        };
+
+        enum class PrimitiveKind : uint8_t
+        {
+            PRIM_FILL,
+            PRIM_BLEND,
+            PRIM_SPRITE_COPY,
+            PRIM_SPRITE_BLEND
+        };
+
+        struct Primitive
+        {
+            int x0, y0, x1, y1; // Covered pixels [x0, x1) x [y0, y1), clipped to the screen
+            PrimitiveKind kind;
+            uint32_t color; // PRIM_FILL and PRIM_BLEND
+            const Sprite *sprite;
+            // Sprite pixel under the center of pixel (x0, y0) and the step per pixel, in 16.16 fixed point
+            int32_t u, v, du, dv;
+        };
+
+        void pushCommands(const Common::RenderCommand *commands, size_t count, float offsetX, float offsetY);
+        void pushRect(float x, float y, float width, float height, PrimitiveKind kind, uint32_t color);
+        void pushSprite(const Common::RenderCommand &cmd, float offsetX, float offsetY, const Sprite &sprite);
+        void binPrimitives();
+        void rasterizeTile(size_t tile);
+        void rasterizeSprite(const Primitive &primitive, int x0, int y0, int x1, int y1);
+        void saveCapture();
+
+        SDL_Renderer *m_sdlRenderer = nullptr;
+        SDL_Texture *m_frameTexture = nullptr;
+        Utils::JobSystem *m_jobs;
+        const SpanKernels &m_kernels;
+
+        std::array<Sprite, (size_t)Common::TextureID::TEX_COUNT> m_sprites{};
+        std::array<Sprite, (size_t)Common::TextureID::TEX_COUNT> m_stagedSprites{};
+
+        std::vector<uint32_t> m_framebuffer;
+        uint32_t m_clearColor = 0;
+
+        std::vector<Primitive> m_primitives;                       // Display list: the frame's clipped rects and sprites, in draw order
+        std::vector<std::vector<uint32_t>> m_tileBins;             // Per screen tile, the m_primitives indices touching it
+        std::vector<uint64_t> m_sortKeys;                          // Layer and index keys of the commands pushCommands() is ordering
+        Utils::FrameVector<Common::RenderCommand> m_chunkCommands; // Tile commands of the static chunk being recorded
+    };
+} // namespace Engine
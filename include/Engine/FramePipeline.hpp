@@ -0,0 +1,113 @@
+#pragma once
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <thread>
+#include <vector>
+
+#include "Engine/InputManager.hpp"
+
+#include "Common/Types.hpp"
+#include "Utils/FrameArena.hpp"
+
+namespace Engine
+{
+    // Arena size per packet; frames that need more fall back to the heap, which the pipeline logs on shutdown
+    inline constexpr size_t FRAME_ARENA_BYTES = 4 * 1024 * 1024;
+
+    // What the main thread hands to the simulation for one frame
+    struct FrameInput
+    {
+        std::vector<InputEvent> events; // Input events polled since the previous frame, oldest first
+        uint64_t timestamp = 0;         // SDL_GetTicksNS() right after polling; the end of the frame's time slice
+        float frameTime = 0.0f;         // Real seconds since the previous frame
+    };
+
+    /**
+     * @brief Everything the main thread needs to draw one simulated frame.
+     *
+     * Transient frame data lives in the packet's own arena. With two packets in flight, each arena
+     * is only reset when the simulation starts rewriting its packet, after the main thread is done
+     * drawing it.
+     */
+    struct FramePacket
+    {
+        FramePacket()
+            : arena(FRAME_ARENA_BYTES), commands(Utils::FrameAllocator<Common::RenderCommand>(&arena)),
+              staticChunks(Utils::FrameAllocator<Common::StaticChunkCommand>(&arena)),
+              particles(Utils::FrameAllocator<Common::ParticleInstance>(&arena)),
+              sounds(Utils::FrameAllocator<Common::SoundEvent>(&arena)) {}
+
+        Utils::FrameArena arena; // Declared first: the lists below allocate from it
+        Utils::FrameVector<Common::RenderCommand> commands;
+        Utils::FrameVector<Common::StaticChunkCommand> staticChunks; // Drawn before `commands`
+        Utils::FrameVector<Common::ParticleInstance> particles;      // Drawn after `commands`
+        Utils::FrameVector<Common::SoundEvent> sounds;               // Sound events of every step in the frame, oldest first
+        Common::StreamFocus focus;                                   // Player at the end of the frame's last step
+        uint64_t frameIndex = 0;
+        int simulationSteps = 0;
+    };
+
+    /**
+     * @brief Two-stage frame pipeline: a simulation thread fills one packet while the main thread draws the other.
+     *
+     * The main thread calls waitForFrame() to take the packet of the frame that was kicked last,
+     * then kick() to start simulating the next frame into the other packet, and draws the taken
+     * packet while the simulation runs. Handoff is done with atomic state flags (no locks), and
+     * each packet is only ever touched by one thread at a time.
+     */
+    class FramePipeline
+    {
+    public:
+        using SimulateFn = std::function<void(const FrameInput &, FramePacket &)>;
+
+        /**
+         * @brief Starts the simulation thread.
+         *
+         * @param simulate Called on the simulation thread once per kicked frame with a packet whose
+         * arena was just reset and whose command list is empty. Frame-lifetime containers should
+         * allocate from `packet.arena`. Everything it touches belongs to the simulation thread until
+         * the pipeline is destroyed.
+         */
+        explicit FramePipeline(SimulateFn simulate);
+        ~FramePipeline();
+
+        FramePipeline(const FramePipeline &) = delete;
+        FramePipeline &operator=(const FramePipeline &) = delete;
+
+        /**
+         * @brief Starts simulating the next frame in the background.
+         *
+         * Must alternate with waitForFrame(): a frame has to be collected before the next kick.
+         */
+        void kick(const FrameInput &frame);
+
+        /**
+         * @brief Blocks until the kicked frame is finished and returns its packet.
+         *
+         * The packet stays valid and untouched by the simulation until the next waitForFrame() call.
+         */
+        const FramePacket &waitForFrame();
+
+    private:
+        enum State : int
+        {
+            STATE_IDLE,
+            STATE_KICKED,
+            STATE_DONE,
+            STATE_STOP
+        };
+
+        void threadLoop();
+
+        SimulateFn m_simulate;
+        FramePacket m_packets[2];
+        int m_front = 0; // Packet owned by the main thread; the simulation writes the other one
+        uint64_t m_frameIndex = 0;
+        FrameInput m_pendingInput;
+
+        std::atomic<int> m_state{STATE_IDLE};
+        std::thread m_thread;
+    };
+} // namespace Engine
@@ -1,56 +1,138 @@
 #pragma once
 #include <SDL3/SDL.h>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
 #include "Common/Types.hpp"
 
 namespace Engine
 {
-    class InputManager
+    // Game-level actions that keys and mouse buttons are bound to
+    enum class Action : uint8_t
+    {
+        ACTION_UP = 0,
+        ACTION_DOWN,
+        ACTION_LEFT,
+        ACTION_RIGHT,
+        ACTION_JUMP,
+        ACTION_ATTACK,
+        ACTION_TOGGLE_FULLSCREEN,
+        ACTION_COUNT,
+        ACTION_NONE = 0xFF
+    };
+
+    // One press or release of a bound action
+    struct InputEvent
     {
+        uint64_t timestamp = 0; // SDL event time in nanoseconds (the SDL_GetTicksNS() clock)
+        Action action = Action::ACTION_NONE;
+        bool pressed = false;
+    };
+
+    // Events buffered between two update() drains; the oldest are dropped beyond this
+    inline constexpr size_t INPUT_QUEUE_CAPACITY = 256;
+
+    /**
+     * @brief Rebindable mapping from keyboard scancodes and mouse buttons to actions.
+     */
+    class ActionBindings
+    {
+    public:
+        // Mouse buttons SDL_BUTTON_LEFT (1) through SDL_BUTTON_X2 (5)
+        static constexpr int MOUSE_BUTTON_COUNT = 6;
+
+        /**
+         * @brief Default layout: WASD to move, Space to jump, left mouse button to attack, F11 for fullscreen.
+         */
+        ActionBindings();
+
+        void bindKey(SDL_Scancode scancode, Action action);
+        void bindMouseButton(Uint8 button, Action action);
+
+        /**
+         * @brief Removes every key and button bound to `action`.
+         */
+        void unbind(Action action);
+
+        Action forKey(SDL_Scancode scancode) const;
+        Action forMouseButton(Uint8 button) const;
+
     private:
-        Common::InputState m_state{};
+        std::array<Action, SDL_SCANCODE_COUNT> m_keys;
+        std::array<Action, MOUSE_BUTTON_COUNT> m_mouseButtons;
+    };
 
+    /**
+     * @brief Polls SDL events and records every bound press and release with its SDL timestamp.
+     *
+     * Events go into a fixed ring buffer and are handed to the simulation with drainEvents(), which
+     * turns them into per-tick input through an InputTickBuilder. That keeps a press and release
+     * landing inside one rendered frame from being lost, and lets each fixed step see the input
+     * that happened during its own slice of time.
+     */
+    class InputManager
+    {
     public:
         /**
-         * @brief Polls system input and updates the stored input state.
+         * @brief Drains the SDL event queue into the ring buffer.
          *
-         * Updates directional and action flags and records high-level input events:
-         * - Sets `quit` when a quit event is received.
-         * - Sets `toggleFullScreen` when the F11 key is pressed.
-         * - Updates `up`, `down`, `left`, `right` from the W/S/A/D keys.
-         * - Updates `jump` from the Space key.
-         * - Updates `attack` from the left mouse button.
+         * Key repeats are ignored. Window focus loss releases every held action, since the release
+         * events would otherwise never arrive.
          *
-         * @return Common::InputState The updated input state reflecting the current values of
-         * `up`, `down`, `left`, `right`, `jump`, `attack`, `toggleFullScreen`, and `quit`.
+         * @return Common::InputState Held actions after the polled events, with `toggleFullScreen`
+         * set if the toggle was pressed since the last call and `quit` once a quit was requested.
          */
-        Common::InputState update()
-        {
-            m_state.toggleFullScreen = false;
-            SDL_Event event;
-
-            while (SDL_PollEvent(&event))
-            {
-                if (event.type == SDL_EVENT_QUIT)
-                    m_state.quit = true;
-                if (event.type == SDL_EVENT_KEY_DOWN)
-                {
-                    if (event.key.scancode == SDL_SCANCODE_F11)
-                    {
-                        m_state.toggleFullScreen = true;
-                    }
-                }
-            }
-            const bool *keys = SDL_GetKeyboardState(nullptr);
-            m_state.up = keys[SDL_SCANCODE_W];
-            m_state.down = keys[SDL_SCANCODE_S];
-            m_state.left = keys[SDL_SCANCODE_A];
-            m_state.right = keys[SDL_SCANCODE_D];
-            m_state.jump = keys[SDL_SCANCODE_SPACE];
-
-            SDL_MouseButtonFlags mouseButtons = SDL_GetMouseState(nullptr, nullptr);
-            m_state.attack = (mouseButtons & SDL_BUTTON_MASK(SDL_BUTTON_LEFT)) != 0;
-
-            return m_state;
-        }
+        Common::InputState update();
+
+        /**
+         * @brief Appends the buffered events to `out` in arrival order and empties the buffer.
+         */
+        void drainEvents(std::vector<InputEvent> &out);
+
+        ActionBindings &getBindings() { return m_bindings; }
+
+        // Events lost because the buffer was full (total since construction)
+        size_t getDroppedEvents() const { return m_dropped; }
+
+    private:
+        void push(uint64_t timestamp, Action action, bool pressed);
+
+        ActionBindings m_bindings;
+        std::array<InputEvent, INPUT_QUEUE_CAPACITY> m_queue{};
+        size_t m_head = 0; // Oldest buffered event
+        size_t m_count = 0;
+        size_t m_dropped = 0;
+
+        std::array<bool, (size_t)Action::ACTION_COUNT> m_held{};
+        bool m_quit = false;
+    };
+
+    /**
+     * @brief Replays timestamped input events onto fixed simulation ticks. Owned by the simulation thread.
+     *
+     * Held actions reflect every event up to the end of the tick. Jump and attack are also reported
+     * for a tick in which they were pressed and released again, so short taps are never dropped.
+     */
+    class InputTickBuilder
+    {
+    public:
+        /**
+         * @brief Queues events for later ticks; they must arrive in timestamp order.
+         */
+        void push(const std::vector<InputEvent> &events);
+
+        /**
+         * @brief Applies the queued events stamped at or before `tickEnd` and returns the tick's input.
+         *
+         * @param tickEnd Real time (SDL_GetTicksNS() clock) that the end of the tick corresponds to.
+         */
+        Common::InputState buildTick(uint64_t tickEnd);
+
+    private:
+        std::vector<InputEvent> m_pending;
+        size_t m_next = 0; // First pending event not yet applied
+        std::array<bool, (size_t)Action::ACTION_COUNT> m_held{};
     };
-}
\ No newline at end of file
+} // namespace Engine
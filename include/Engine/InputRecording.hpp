@@ -0,0 +1,61 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "Common/Types.hpp"
+
+namespace Engine
+{
+    // Bumped whenever the file layout or the input bit assignment changes
+    inline constexpr uint32_t INPUT_RECORDING_VERSION = 1;
+
+    /**
+     * @brief Packs an input state into one byte, one bit per field in declaration order.
+     */
+    uint8_t packInput(const Common::InputState &input);
+
+    /**
+     * @brief Inverse of packInput().
+     */
+    Common::InputState unpackInput(uint8_t bits);
+
+    /**
+     * @brief Per-tick input stream that can be saved to and replayed from a compact binary file.
+     *
+     * One entry is stored per fixed simulation step (not per rendered frame), so replaying the
+     * entries through World::step() reproduces the recorded run exactly, independent of frame rate.
+     *
+     * File layout (little-endian): "RPLY", u32 version, u32 ticks per second, u32 tick count,
+     * then one packed input byte per tick.
+     */
+    class InputRecording
+    {
+    public:
+        void append(const Common::InputState &input) { m_ticks.push_back(packInput(input)); }
+        Common::InputState at(size_t tick) const { return unpackInput(m_ticks[tick]); }
+        size_t size() const { return m_ticks.size(); }
+        void clear() { m_ticks.clear(); }
+
+        /**
+         * @brief Writes the recording to `path`. Errors are logged.
+         *
+         * @return true on success.
+         */
+        bool save(const std::string &path) const;
+
+        /**
+         * @brief Replaces the contents with the recording stored at `path`.
+         *
+         * Files with a different version or tick rate than this build are rejected, since they
+         * would not replay the same simulation. Errors are logged.
+         *
+         * @return true on success; on failure the recording is left empty.
+         */
+        bool load(const std::string &path);
+
+    private:
+        std::vector<uint8_t> m_ticks;
+    };
+} // namespace Engine
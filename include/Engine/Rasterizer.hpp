@@ -0,0 +1,40 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+#include "Utils/Simd.hpp"
+
+namespace Engine
+{
+    // Rasterizer pixels are 0xAARRGGBB words (SDL_PIXELFORMAT_ARGB8888) with color premultiplied by alpha
+
+    /**
+     * @brief Span kernels of the CPU rasterizer for one instruction set.
+     *
+     * Blending is premultiplied source-over: dst = src + dst * (255 - srcAlpha) / 255 per channel,
+     * with the division rounded. Every variant produces bit-identical pixels, so captured frames do
+     * not depend on the CPU they were rendered on.
+     */
+    struct SpanKernels
+    {
+        void (*fill)(uint32_t *dst, size_t count, uint32_t color);
+        void (*blendColor)(uint32_t *dst, size_t count, uint32_t color);
+        void (*blendPixels)(uint32_t *dst, const uint32_t *src, size_t count);
+    };
+
+    /**
+     * @brief Kernels for `level`, lowered to what the running CPU supports.
+     */
+    const SpanKernels &getSpanKernels(Utils::SimdLevel level);
+
+    /**
+     * @brief Converts straight-alpha 0xRRGGBBAA (Common::ParticleInstance, fallback colors) to a rasterizer pixel.
+     */
+    uint32_t rgbaToPixel(uint32_t rgba);
+
+    /**
+     * @brief Premultiplies a straight-alpha 0xAARRGGBB pixel.
+     */
+    uint32_t premultiplyArgb(uint32_t argb);
+} // namespace Engine
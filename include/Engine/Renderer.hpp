@@ -1,48 +1,158 @@
 #pragma once
 #include <SDL3/SDL.h>
-#include <unordered_map>
-#include <vector>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <string>
 
 #include "Common/Types.hpp"
+#include "Utils/FrameArena.hpp"
+
+namespace Utils
+{
+    class JobSystem;
+}
 
 namespace Engine
 {
+    // Per-frame counters, reset by beginFrame()
+    struct RenderStats
+    {
+        size_t commandsReceived = 0;
+        size_t drawCalls = 0;
+        size_t staticChunksDrawn = 0;
+        size_t staticChunksRebuilt = 0; // Chunk textures re-rendered this frame (cache misses)
+        size_t particlesDrawn = 0;
+    };
+
+    // Gray level of the game-area background, under every static chunk
+    inline constexpr uint8_t BACKGROUND_GRAY = 30;
+
+    /**
+     * @brief Emits the commands of one static chunk, relative to the chunk's top-left corner.
+     */
+    using StaticChunkSource = std::function<void(int chunkX, int chunkY, Utils::FrameVector<Common::RenderCommand> &out)>;
+
+    enum class RendererBackend
+    {
+        RENDERER_SDL, // SDL_Renderer with whatever driver SDL picks (GPU, or its generic software path)
+        RENDERER_CPU  // Own SIMD tile rasterizer; one streaming texture upload per frame
+    };
+
+    /**
+     * @brief Draws one frame of render commands; implemented by a backend per rendering strategy.
+     *
+     * A frame is beginFrame(), then drawStaticChunks(), drawCommands() and drawParticles() in that
+     * order, then endFrame(), which shows it. All of it runs on the thread that owns the window.
+     */
     class Renderer
     {
     public:
-        Renderer(SDL_Window *window);
-        ~Renderer();
-
         /**
-         * @brief Disable copy construction to prevent multiple instances from sharing or duplicating underlying SDL resources.
+         * @brief Creates the renderer for `window`.
+         *
+         * @param window Window to present to; the CPU backend also works without one (frames are only captured).
+         * @param jobs Worker pool the CPU backend rasterizes tiles on; nullptr rasterizes on the calling thread.
          */
+        static std::unique_ptr<Renderer> create(RendererBackend backend, SDL_Window *window, Utils::JobSystem *jobs = nullptr);
+
+        virtual ~Renderer() = default;
+
         Renderer(const Renderer &) = delete;
+        Renderer &operator=(const Renderer &) = delete;
+        Renderer(Renderer &&) = delete;
+        Renderer &operator=(Renderer &&) = delete;
+
         /**
-         * @brief Deleted copy assignment operator to prevent copying of Renderer instances.
+         * @brief Loads a BMP sprite on the calling thread and stages it for the next buildAtlas() call.
          *
-         * Copying is disallowed to ensure unique ownership of the underlying SDL renderer and associated resources.
+         * @param id Texture slot the sprite is drawn for.
+         * @param path Path to the image file.
+         * @return true if the image was loaded, false otherwise (the slot keeps its fallback color).
          */
-        Renderer &operator=(const Renderer &) = delete;
+        bool loadTexture(Common::TextureID id, const std::string &path);
+
         /**
-         * @brief Disables move construction for Renderer.
+         * @brief Stages an already decoded sprite (e.g. from the AssetStreamer) for the next buildAtlas() call.
+         *
+         * Converts it to the backend's pixel format; `surface` stays owned by the caller.
          *
-         * Prevents moving a Renderer instance to preserve unique ownership of the internal SDL resources
-         * and texture cache.
+         * @return false if `id` is out of range or the conversion failed.
          */
-        Renderer(Renderer &&) = delete;
+        virtual bool addTexture(Common::TextureID id, SDL_Surface *surface) = 0;
+
         /**
-         * @brief Disable move assignment for Renderer.
+         * @brief Makes every sprite staged by loadTexture() or addTexture() available for drawing.
          *
-         * Prevents transferring ownership of the Renderer and its internal SDL resources by deleting the move assignment operator.
+         * @return int Number of sprites that were made available.
          */
-        Renderer &operator=(Renderer &&) = delete;
-        // TODO: add textures, bool loadTexture(int id, const std::string& path);
-        void beginFrame();
-        void drawCommands(const std::vector<Common::RenderCommand> &commands);
-        void endFrame();
-
-    private:
-        SDL_Renderer *m_sdlRenderer;
-        std::unordered_map<Common::TextureID, SDL_Texture *> m_textureCache;
+        virtual int buildAtlas() = 0;
+
+        virtual void beginFrame() = 0;
+
+        /**
+         * @brief Sets where chunk contents come from when drawStaticChunks() needs a chunk's tiles.
+         *
+         * The source is called from drawStaticChunks() on the rendering thread.
+         */
+        void setStaticChunkSource(StaticChunkSource source) { m_staticSource = std::move(source); }
+
+        /**
+         * @brief Draws static layers (background and tiles) chunk by chunk.
+         *
+         * Call after beginFrame() and before drawCommands().
+         */
+        virtual void drawStaticChunks(const Utils::FrameVector<Common::StaticChunkCommand> &chunks) = 0;
+
+        /**
+         * @brief Drops anything cached from static chunks so each is rebuilt the next time it is drawn.
+         */
+        virtual void invalidateStaticCache() = 0;
+
+        /**
+         * @brief Draws commands ordered by `layer`, keeping submission order within a layer.
+         *
+         * Commands whose sprite is not loaded are drawn as rectangles of getFallbackColor().
+         */
+        virtual void drawCommands(const Utils::FrameVector<Common::RenderCommand> &commands) = 0;
+
+        /**
+         * @brief Draws every particle as an alpha-blended colored square.
+         *
+         * Call after drawCommands(), so particles are drawn over entities.
+         */
+        virtual void drawParticles(const Utils::FrameVector<Common::ParticleInstance> &particles) = 0;
+
+        /**
+         * @brief Finishes the frame and presents it.
+         */
+        virtual void endFrame() = 0;
+
+        /**
+         * @brief Writes the next frame to `path` as a BMP when it is finished, before it is presented.
+         *
+         * Used for golden-image comparisons; an empty path cancels a pending capture.
+         */
+        void captureNextFrame(std::string path) { m_capturePath = std::move(path); }
+
+        const RenderStats &getFrameStats() const { return m_stats; }
+
+        /**
+         * @brief Color of commands whose sprite is not loaded, as 0xRRGGBBAA like Common::ParticleInstance.
+         *
+         * - `Common::TextureID::TEX_PLAYER` → red (255,0,0,255)
+         * - `Common::TextureID::TEX_WALL` → slate (90,100,120,255)
+         * - `Common::TextureID::TEX_FLOOR` → brown (140,100,60,255)
+         * - `Common::TextureID::TEX_PROJECTILE` → yellow (255,220,0,255)
+         * - otherwise → cyan (0,255,255,255)
+         */
+        static uint32_t getFallbackColor(Common::TextureID id);
+
+    protected:
+        Renderer() = default;
+
+        StaticChunkSource m_staticSource;
+        std::string m_capturePath; // Consumed by the next endFrame()
+        RenderStats m_stats;
     };
-} // namespace Engine
\ No newline at end of file
+} // namespace Engine
@@ -0,0 +1,95 @@
+#pragma once
+#include <SDL3/SDL.h>
+#include <array>
+#include <string>
+#include <vector>
+
+#include "Common/Types.hpp"
+#include "Engine/Renderer.hpp"
+#include "Engine/TextureAtlas.hpp"
+#include "Utils/FrameArena.hpp"
+
+namespace Engine
+{
+    // Chunk textures kept alive at once; at 1024 px chunks each one is 4 MiB
+    inline constexpr size_t STATIC_CHUNK_CACHE_SIZE = 12;
+
+    /**
+     * @brief Renderer backend on SDL_Renderer: sprites packed into atlas textures, commands batched
+     * into SDL_RenderGeometry calls, and static chunks cached as render-target textures.
+     */
+    class SdlRenderer final : public Renderer
+    {
+    public:
+        /**
+         * @brief Creates an SDL renderer for `window` with SDL's default driver choice.
+         */
+        explicit SdlRenderer(SDL_Window *window);
+        ~SdlRenderer() override;
+
+        bool addTexture(Common::TextureID id, SDL_Surface *surface) override;
+
+        /**
+         * @brief Packs every sprite staged by loadTexture() or addTexture() into atlas pages and uploads them.
+         *
+         * @return int Number of sprites that were packed.
+         */
+        int buildAtlas() override;
+
+        void beginFrame() override;
+
+        /**
+         * @brief Draws static layers (background and tiles) as one cached texture per chunk.
+         */
+        void drawStaticChunks(const Utils::FrameVector<Common::StaticChunkCommand> &chunks) override;
+        void invalidateStaticCache() override;
+        void drawCommands(const Utils::FrameVector<Common::RenderCommand> &commands) override;
+
+        /**
+         * @brief Draws every particle as an alpha-blended colored square, in a single geometry submission.
+         */
+        void drawParticles(const Utils::FrameVector<Common::ParticleInstance> &particles) override;
+        void endFrame() override;
+
+        /**
+         * @brief Looks up the atlas region a texture ID was packed into.
+         */
+        const AtlasRegion *findRegion(Common::TextureID id) const;
+
+    private:
+        struct CachedChunk
+        {
+            int chunkX = 0, chunkY = 0;
+            uint32_t version = 0;
+            SDL_Texture *texture = nullptr;
+            uint64_t lastUsedFrame = 0;
+        };
+
+        void drawBackground();
+        void submitCommands(const Common::RenderCommand *commands, size_t count);
+        void appendQuad(const Common::RenderCommand &cmd, const SDL_FColor &color, const AtlasRegion *region);
+        void flushBatch(SDL_Texture *texture);
+        void saveCapture();
+
+        /**
+         * @brief Returns an up-to-date texture for the chunk, rendering it on a miss; nullptr if none can be made.
+         */
+        SDL_Texture *acquireChunkTexture(const Common::StaticChunkCommand &chunk);
+
+        SDL_Renderer *m_sdlRenderer;
+        AtlasRegionTable m_textureCache{};
+        std::vector<SDL_Texture *> m_atlasPages;
+        TextureAtlasBuilder m_atlasBuilder;
+
+        // Batching buffers, kept across frames so steady-state drawing does not allocate
+        std::vector<Uint64> m_sortKeys;
+        std::vector<SDL_Vertex> m_vertices;
+        std::vector<int> m_indices;
+
+        // Static layer cache; slots are found by linear search since only a few chunks are ever visible
+        std::array<CachedChunk, STATIC_CHUNK_CACHE_SIZE> m_chunkCache{};
+        Utils::FrameVector<Common::RenderCommand> m_chunkCommands; // Reused while rebuilding a chunk
+        uint64_t m_frameCounter = 0;
+        bool m_backgroundDrawn = false;
+    };
+} // namespace Engine
@@ -0,0 +1,100 @@
+#pragma once
+#include <SDL3/SDL.h>
+#include <array>
+#include <vector>
+
+#include "Common/Constants.hpp"
+
+namespace Engine
+{
+    // Where a sprite lives once packed: its atlas page and normalized UV rectangle on that page
+    struct AtlasRegion
+    {
+        SDL_Texture *texture = nullptr;
+        int page = -1;
+        float u0 = 0.0f, v0 = 0.0f, u1 = 0.0f, v1 = 0.0f;
+    };
+
+    // Flat lookup table indexed by Common::TextureID
+    using AtlasRegionTable = std::array<AtlasRegion, (size_t)Common::TextureID::TEX_COUNT>;
+
+    inline constexpr int ATLAS_PAGE_SIZE = 2048;
+    inline constexpr int ATLAS_PADDING = 1; // Gap between sprites to avoid sampling neighbours
+
+    /**
+     * @brief Skyline bottom-left rectangle packer for a single atlas page.
+     */
+    class RectPacker
+    {
+    public:
+        RectPacker(int width, int height);
+
+        /**
+         * @brief Finds room for a `width` x `height` rectangle and reserves it.
+         *
+         * @param width Rectangle width in pixels.
+         * @param height Rectangle height in pixels.
+         * @param outX Receives the left edge of the placed rectangle.
+         * @param outY Receives the top edge of the placed rectangle.
+         * @return true if the rectangle was placed, false if the page has no room left for it.
+         */
+        bool insert(int width, int height, int &outX, int &outY);
+
+    private:
+        struct SkylineNode
+        {
+            int x, y, width;
+        };
+
+        int fitAt(size_t index, int width, int height) const;
+
+        int m_width;
+        int m_height;
+        std::vector<SkylineNode> m_skyline;
+    };
+
+    /**
+     * @brief Collects sprite surfaces and packs them into as few atlas textures as possible.
+     */
+    class TextureAtlasBuilder
+    {
+    public:
+        TextureAtlasBuilder() = default;
+        ~TextureAtlasBuilder();
+
+        TextureAtlasBuilder(const TextureAtlasBuilder &) = delete;
+        TextureAtlasBuilder &operator=(const TextureAtlasBuilder &) = delete;
+
+        /**
+         * @brief Stages a sprite for the next build. The builder takes ownership of `surface`.
+         *
+         * Staging the same ID twice replaces the earlier surface.
+         */
+        void add(Common::TextureID id, SDL_Surface *surface);
+
+        /**
+         * @brief Packs all staged sprites into atlas pages and uploads them as textures.
+         *
+         * Staged surfaces are released afterwards whether or not they fit.
+         *
+         * @param renderer Renderer that will own the created page textures.
+         * @param pages Receives the created page textures; the caller destroys them.
+         * @param regions Receives the page and UV rectangle of every packed sprite.
+         * @return int Number of sprites packed.
+         */
+        int build(SDL_Renderer *renderer, std::vector<SDL_Texture *> &pages, AtlasRegionTable &regions);
+
+        bool empty() const { return m_staged.empty(); }
+
+    private:
+        struct StagedSprite
+        {
+            Common::TextureID id;
+            SDL_Surface *surface;
+        };
+
+        void clear();
+
+        std::vector<StagedSprite> m_staged;
+    };
+} // namespace Engine
@@ -5,6 +5,8 @@
 
 #include "Engine/InputManager.hpp"
 
+#include "Utils/FpsCounter.hpp"
+
 namespace Engine
 {
 
@@ -58,16 +60,16 @@ namespace Engine
         void update(const Common::InputState &input);
 
         /**
-         * @brief Updates FPS counter state.
+         * @brief Shows frame statistics in the window title.
          *
-         * @param currentTick Current tick count, updated by this method.
-         * @param lastTime Last recorded time, updated by this method.
-         * @param fps Computed frames per second, updated by this method.
+         * @param stats Statistics to display, typically from Utils::FpsCounter::getStats().
          */
-        void fpsCounter(const Uint64 &currentTick, Uint64 &lastTime, Uint64 &fps);
+        void showFrameStats(const Utils::FrameStats &stats);
 
     private:
         std::unique_ptr<SDL_Window, SDLDeleter> m_window;
+        // Title text is formatted in place so refreshing it does not allocate
+        char m_title[160] = {};
         bool m_sdlInitialized = false;
     };
 
@@ -0,0 +1,44 @@
+#pragma once
+
+#include <algorithm>
+
+#include "Common/Types.hpp"
+#include "Common/Constants.hpp"
+
+namespace Gameplay
+{
+    // World-space viewport; everything drawn is offset by its top-left corner
+    class Camera
+    {
+    public:
+        float x = 0.0f, y = 0.0f;
+        float width = (float)Common::SCREEN_WIDTH;
+        float height = (float)Common::SCREEN_HEIGHT;
+
+        /**
+         * @brief Centers the camera on a world position without showing anything outside the world.
+         *
+         * If the world is smaller than the viewport on an axis, the camera stays at 0 on that axis.
+         *
+         * @param targetX World x coordinate to center on.
+         * @param targetY World y coordinate to center on.
+         * @param worldWidth Width of the world in pixels.
+         * @param worldHeight Height of the world in pixels.
+         */
+        void follow(float targetX, float targetY, float worldWidth, float worldHeight)
+        {
+            x = std::clamp(targetX - width * 0.5f, 0.0f, std::max(0.0f, worldWidth - width));
+            y = std::clamp(targetY - height * 0.5f, 0.0f, std::max(0.0f, worldHeight - height));
+        }
+
+        /**
+         * @brief Converts a world-space render command into screen space.
+         */
+        Common::RenderCommand toScreen(Common::RenderCommand command) const
+        {
+            command.x -= x;
+            command.y -= y;
+            return command;
+        }
+    };
+} // namespace Gameplay
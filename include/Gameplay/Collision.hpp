@@ -0,0 +1,47 @@
+#pragma once
+
+#include "Gameplay/Tilemap.hpp"
+
+namespace Gameplay
+{
+    // Axis-aligned box in world pixels, (x, y) is the top-left corner
+    struct AABB
+    {
+        float x = 0.0f, y = 0.0f;
+        float width = 0.0f, height = 0.0f;
+    };
+
+    // Which sides of the box hit a solid tile during the last move
+    struct CollisionContacts
+    {
+        bool ground = false;
+        bool ceiling = false;
+        bool wallLeft = false;
+        bool wallRight = false;
+    };
+
+    /**
+     * @brief Returns whether a tile blocks movement.
+     */
+    inline bool isSolid(TileType tile)
+    {
+        return tile != TileType::TILE_EMPTY;
+    }
+
+    /**
+     * @brief Moves a box through the tile grid by its velocity, stopping flush against the first solid tile.
+     *
+     * The move is swept one axis at a time (x, then y). Along each axis only the columns or rows
+     * between the box's leading edge and its destination are tested, across the rows or columns the
+     * box spans, so fast movers cannot tunnel through thin walls and the cost is O(cells touched).
+     * The velocity component of a blocked axis is zeroed.
+     *
+     * @param map Tile grid to collide against; tiles outside the map count as solid.
+     * @param box Box to move, updated in place.
+     * @param velocityX Horizontal velocity in pixels per second, zeroed on a wall hit.
+     * @param velocityY Vertical velocity in pixels per second, zeroed on a ground or ceiling hit.
+     * @param deltaTime Time step in seconds.
+     * @return CollisionContacts Sides that were blocked during this move.
+     */
+    CollisionContacts moveAndCollide(const Tilemap &map, AABB &box, float &velocityX, float &velocityY, float deltaTime);
+} // namespace Gameplay
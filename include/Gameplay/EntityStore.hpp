@@ -0,0 +1,105 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "Common/Constants.hpp"
+
+namespace Gameplay
+{
+    class WorldSnapshot;
+    class SnapshotReader;
+
+    // Generational handle: stale handles to destroyed (and possibly reused) slots are detected
+    struct EntityHandle
+    {
+        static constexpr uint32_t INVALID_INDEX = 0xFFFFFFFFu;
+
+        uint32_t index = INVALID_INDEX;
+        uint32_t generation = 0;
+
+        bool isValid() const { return index != INVALID_INDEX; }
+        bool operator==(const EntityHandle &other) const = default;
+    };
+
+    enum class EntityKind : uint8_t
+    {
+        ENTITY_PLAYER = 0,
+        ENTITY_ENEMY = 1,
+        ENTITY_PROJECTILE = 2
+    };
+
+    // Bits of the `flags` column
+    enum EntityFlags : uint8_t
+    {
+        ENTITY_ON_GROUND = 1 << 0,
+        ENTITY_FACING_LEFT = 1 << 1,
+    };
+
+    /**
+     * @brief Structure-of-arrays entity storage.
+     *
+     * Every component is a dense column indexed by the same dense index, so systems walk plain
+     * contiguous arrays. Destroying an entity moves the last entity into its place (swap-and-pop);
+     * handles stay valid across that move because they go through a slot table.
+     */
+    class EntityStore
+    {
+    public:
+        // --- Component columns (dense, all the same length) ---
+        std::vector<float> posX, posY;
+        std::vector<float> prevX, prevY; // Position at the start of the current simulation step
+        std::vector<float> velX, velY;
+        std::vector<float> width, height;
+        std::vector<float> lifetime; // Seconds left; only meaningful for kinds that expire
+        std::vector<Common::TextureID> texture;
+        std::vector<EntityKind> kind;
+        std::vector<uint8_t> flags;
+
+        /**
+         * @brief Appends a new entity with zero velocity.
+         *
+         * @return EntityHandle Handle to the new entity.
+         */
+        EntityHandle create(EntityKind entityKind, float x, float y, float w, float h, Common::TextureID textureID);
+
+        /**
+         * @brief Removes an entity by moving the last dense entity into its place. Stale handles are ignored.
+         */
+        void destroy(EntityHandle handle);
+
+        /**
+         * @brief Removes the entity at a dense index. Iterating backwards keeps this safe inside a loop.
+         */
+        void destroyAt(size_t denseIndex);
+
+        bool isAlive(EntityHandle handle) const;
+
+        /**
+         * @brief Returns the dense index of a live entity, or `NOT_FOUND` for a stale handle.
+         */
+        size_t indexOf(EntityHandle handle) const;
+
+        size_t size() const { return posX.size(); }
+        void reserve(size_t capacity);
+
+        /**
+         * @brief Appends every column but prevX/prevY, and the slot tables, to `out`; handles survive a restore.
+         */
+        void save(WorldSnapshot &out) const;
+
+        /**
+         * @brief Replaces the whole store with what save() wrote, with prevX/prevY set to the position; false if the snapshot is truncated.
+         */
+        bool load(SnapshotReader &in);
+
+        static constexpr size_t NOT_FOUND = (size_t)-1;
+
+    private:
+        std::vector<uint32_t> m_denseToSlot;
+        std::vector<uint32_t> m_slotToDense;
+        std::vector<uint32_t> m_slotGeneration;
+        std::vector<uint32_t> m_freeSlots;
+    };
+} // namespace Gameplay
@@ -0,0 +1,93 @@
+#pragma once
+
+#include <vector>
+
+#include "Gameplay/EntityStore.hpp"
+#include "Gameplay/FlowField.hpp"
+#include "Gameplay/SpatialHash.hpp"
+#include "Gameplay/Tilemap.hpp"
+#include "Gameplay/Camera.hpp"
+
+#include "Utils/JobSystem.hpp"
+#include "Utils/FrameArena.hpp"
+
+#include "Common/Types.hpp"
+
+namespace Gameplay
+{
+    // Entities handed to one job when a system is split across worker threads
+    inline constexpr size_t ENTITY_JOB_GRAIN = 2048;
+
+    // Reusable gather buffers so bulk systems do not allocate every step
+    struct SystemScratch
+    {
+        std::vector<uint32_t> indices;
+        std::vector<float> moveDir;
+        std::vector<float> velX, velY;
+        std::vector<uint32_t> found; // Spatial hash query results
+    };
+
+    /**
+     * @brief Records every entity's position as the previous position for render interpolation.
+     *
+     * Call once at the start of each simulation step, before any system moves entities.
+     */
+    void beginStep(EntityStore &entities);
+
+    /**
+     * @brief Moves enemies under gravity along `flow`, or back and forth, turning at walls, where it has no path.
+     *
+     * Enemies on the ground read their next move from the flow field under their feet; airborne
+     * ones keep going the way they face. Enemy velocities are gathered into `scratch` and updated
+     * in batches by the SIMD movement kernel, then each enemy is collided with the tile grid. With
+     * `jobs`, batches run in parallel; every enemy only writes its own columns, so the result does
+     * not depend on the thread count.
+     *
+     * @param flow Field toward the player, or nullptr for patrolling only.
+     */
+    void updateEnemies(EntityStore &entities, const Tilemap &map, float deltaTime, SystemScratch &scratch, const FlowField *flow = nullptr,
+                       Utils::JobSystem *jobs = nullptr);
+
+    /**
+     * @brief Moves projectiles in a straight line and destroys those that hit a tile or run out of lifetime.
+     */
+    void updateProjectiles(EntityStore &entities, const Tilemap &map, float deltaTime, Utils::JobSystem *jobs = nullptr);
+
+    /**
+     * @brief Moves projectiles and zeroes the lifetime of any that hit a tile, without removing anything.
+     *
+     * Safe to run in parallel with other systems that do not create or destroy entities.
+     */
+    void moveProjectiles(EntityStore &entities, const Tilemap &map, float deltaTime, Utils::JobSystem *jobs = nullptr);
+
+    /**
+     * @brief Zeroes the lifetime of every live projectile overlapping an enemy, so it is removed like one that hit a wall.
+     *
+     * `hash` must have been built from `entities` after they last moved. Writes projectile lifetimes
+     * only, in dense index order, so the result does not depend on the thread that runs it.
+     */
+    void hitEnemies(EntityStore &entities, const SpatialHash &hash, SystemScratch &scratch);
+
+    /**
+     * @brief Destroys projectiles whose lifetime has run out. Must run on its own, as it reorders the store.
+     *
+     * @return Number of projectiles destroyed; any makes dense indices taken before the call stale.
+     */
+    size_t removeSpentProjectiles(EntityStore &entities);
+
+    /**
+     * @brief Appends a screen-space render command for every entity overlapping the camera.
+     *
+     * @param entities Entity columns to draw.
+     * @param camera Viewport in world space.
+     * @param alpha Fraction of a simulation step elapsed since the last update, in [0, 1].
+     * @param out Command list the entity commands are appended to.
+     */
+    void collectRenderCommands(const EntityStore &entities, const Camera &camera, float alpha, Utils::FrameVector<Common::RenderCommand> &out);
+
+    /**
+     * @brief Same as collectRenderCommands() for the dense index range [begin, end) only.
+     */
+    void collectRenderCommands(const EntityStore &entities, const Camera &camera, float alpha, size_t begin, size_t end,
+                               Utils::FrameVector<Common::RenderCommand> &out);
+} // namespace Gameplay
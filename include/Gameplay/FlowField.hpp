@@ -0,0 +1,168 @@
+#pragma once
+
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "Gameplay/Tilemap.hpp"
+
+#include "Utils/JobSystem.hpp"
+
+#include "Common/Constants.hpp"
+
+namespace Gameplay
+{
+    // Free tiles an enemy needs above the ground it stands on (Common::ENEMY_HEIGHT rounded up to whole tiles)
+    inline constexpr int FLOW_CLEARANCE_TILES = ((int)Common::ENEMY_HEIGHT + Common::TILE_SIZE - 1) / Common::TILE_SIZE;
+    // Jump links an enemy can follow with Common::ENEMY_JUMP_FORCE at Common::ENEMY_SPEED, in tiles up and across
+    inline constexpr int FLOW_JUMP_HEIGHT_TILES = 3;
+    inline constexpr int FLOW_JUMP_REACH_TILES = 2;
+    // Added to a jump link's tile count, so enemies walk when walking is about as short
+    inline constexpr uint32_t FLOW_JUMP_COST = 2;
+    // Distances bucketed at once from which a field rebuild relaxes them on the worker pool
+    inline constexpr size_t FLOW_PARALLEL_FRONTIER = 2048;
+    // Nodes handed to one job by the parallel passes of a rebuild
+    inline constexpr size_t FLOW_JOB_GRAIN = 1024;
+    // Tile rows handed to one job when the graph is built in parallel
+    inline constexpr size_t FLOW_ROW_GRAIN = 32;
+
+    // What an enemy standing on a tile does next to get closer to the target
+    enum class FlowMove : uint8_t
+    {
+        FLOW_UNREACHABLE = 0, // Not a standing tile, or no path to the target
+        FLOW_ARRIVED,         // Standing on the target tile
+        FLOW_LEFT,            // Walk left (possibly off a ledge)
+        FLOW_RIGHT,
+        FLOW_JUMP_LEFT, // Jump, moving left
+        FLOW_JUMP_RIGHT
+    };
+
+    /**
+     * @brief Shared path field toward one target over the tile grid, read by any number of enemies in O(1).
+     *
+     * The graph's nodes are standing tiles: free tiles with FLOW_CLEARANCE_TILES of headroom and a
+     * solid tile below. Links follow how an enemy can move between them: walking to a neighbour,
+     * walking off a ledge and falling to whatever is below, and jumping up to
+     * FLOW_JUMP_HEIGHT_TILES onto a ledge or over a gap up to FLOW_JUMP_REACH_TILES across.
+     *
+     * update() computes every node's distance to the target with a bucketed Dijkstra over the
+     * reversed links (integer link costs), then stores for each node the first move of its
+     * shortest path. It only does so when the target moves to another node, so a player standing
+     * still costs nothing. Results do not depend on the worker count.
+     *
+     * The graph is built from the tiles once, by build(); call it again after editing tiles.
+     */
+    class FlowField
+    {
+    public:
+        static constexpr uint32_t NO_NODE = 0xFFFFFFFFu;
+        static constexpr uint32_t UNREACHABLE = 0xFFFFFFFFu;
+
+        /**
+         * @brief Builds the standing-tile graph of `map` and clears the field. With `jobs`, rows are scanned in parallel.
+         */
+        void build(const Tilemap &map, Utils::JobSystem *jobs = nullptr);
+
+        /**
+         * @brief Points the field at the standing tile under a world position (e.g. the player's feet).
+         *
+         * A target in the air drops to the first standing tile below it. The field is rebuilt only
+         * if that tile differs from the current target's; with no standing tile below, every tile
+         * becomes unreachable.
+         *
+         * @return true if the field was rebuilt.
+         */
+        bool update(float targetX, float targetY, Utils::JobSystem *jobs = nullptr);
+
+        /**
+         * @brief Forgets the target, so the next update() rebuilds the field.
+         */
+        void invalidate() { m_target = NO_NODE; m_hasField = false; }
+
+        /**
+         * @brief Next move for an enemy whose feet are at a world position; O(1).
+         */
+        FlowMove getMove(float x, float y) const
+        {
+            const uint32_t node = nodeAtPoint(x, y);
+            return node == NO_NODE ? FlowMove::FLOW_UNREACHABLE : m_move[node];
+        }
+
+        /**
+         * @brief Path cost from the standing tile at a world position to the target, or UNREACHABLE.
+         */
+        uint32_t getDistance(float x, float y) const
+        {
+            const uint32_t node = nodeAtPoint(x, y);
+            return node == NO_NODE ? UNREACHABLE : m_distance[node];
+        }
+
+        size_t getNodeCount() const { return m_move.size(); }
+        size_t getLinkCount() const { return m_linkTarget.size(); }
+
+        /**
+         * @brief Nodes reached by the last rebuild, the target included.
+         */
+        size_t getReachedCount() const { return m_reached; }
+
+    private:
+        struct Link
+        {
+            uint32_t target;
+            uint16_t cost;
+            FlowMove move;
+        };
+
+        uint32_t nodeAt(int tileX, int tileY) const;
+
+        uint32_t nodeAtPoint(float x, float y) const
+        {
+            return nodeAt((int)std::floor(x / Common::TILE_SIZE), (int)std::floor(y / Common::TILE_SIZE));
+        }
+
+        /**
+         * @brief Appends the links out of the standing tile (tileX, tileY), given the map's solid tiles as a bitset laid out like m_standing.
+         */
+        void collectLinks(const std::vector<uint64_t> &solidBits, int tileX, int tileY, std::vector<Link> &out) const;
+
+        void rebuild(Utils::JobSystem *jobs);
+
+        /**
+         * @brief Relaxes the reverse links of the nodes settled at `distance`, queueing improved sources.
+         */
+        void relaxBucket(std::vector<uint32_t> &bucket, uint32_t distance, Utils::JobSystem *jobs);
+        void queueNode(uint32_t node, uint32_t distance);
+
+        int m_width = 0, m_height = 0; // Map size in tiles
+        size_t m_wordsPerRow = 0;
+
+        // Node lookup: one bit per tile (row-major, rows padded to whole words) plus a running count per word
+        std::vector<uint64_t> m_standing;
+        std::vector<uint32_t> m_rankBase;
+
+        // Links out of each node (CSR), in the order collectLinks() emits them
+        std::vector<uint32_t> m_linkStart;
+        std::vector<uint32_t> m_linkTarget;
+        std::vector<uint16_t> m_linkCost;
+        std::vector<FlowMove> m_linkMove;
+
+        // The same links reversed: for each node, the nodes linking to it
+        std::vector<uint32_t> m_reverseStart;
+        std::vector<uint32_t> m_reverseSource;
+        std::vector<uint16_t> m_reverseCost;
+        uint32_t m_maxLinkCost = 1;
+
+        // Field toward m_target
+        std::vector<uint32_t> m_distance;
+        std::vector<FlowMove> m_move;
+        uint32_t m_target = NO_NODE;
+        bool m_hasField = false;
+        size_t m_reached = 0;
+
+        // Rebuild scratch, kept between rebuilds
+        std::vector<std::vector<uint32_t>> m_buckets; // Ring indexed by distance modulo its size
+        size_t m_queued = 0;                          // Entries in the ring, stale ones included
+        std::vector<std::vector<uint32_t>> m_jobImproved; // Per parallel job: improved sources, with their new distance
+    };
+} // namespace Gameplay
@@ -0,0 +1,100 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <span>
+#include <string>
+#include <vector>
+
+#include "Gameplay/EntityStore.hpp"
+#include "Gameplay/Tilemap.hpp"
+
+#include "Utils/MappedFile.hpp"
+
+namespace Gameplay
+{
+    inline constexpr char LEVEL_MAGIC[4] = {'L', 'V', 'L', 'B'};
+    inline constexpr uint32_t LEVEL_FORMAT_VERSION = 1;
+    inline constexpr size_t LEVEL_SECTION_ALIGNMENT = 64; // Every section starts on a cache line
+
+    /**
+     * @brief Fixed-size header at offset 0 of a binary level file. All values are little-endian.
+     *
+     * Sections follow in this order, each at an offset that is a multiple of LEVEL_SECTION_ALIGNMENT:
+     * - chunk table: one uint16_t non-empty tile count per chunk, chunks in row-major order
+     * - tiles: Common::CHUNK_SIZE squared TileType bytes per chunk, chunk-major, exactly as Tilemap stores them
+     * - spawns: `spawnCount` LevelSpawn records
+     */
+    struct LevelHeader
+    {
+        char magic[4];
+        uint32_t version;
+        uint32_t headerSize;
+        uint32_t chunkSize; // Tiles per chunk side; must equal Common::CHUNK_SIZE
+        uint32_t widthInChunks;
+        uint32_t heightInChunks;
+        uint32_t spawnCount;
+        uint32_t reserved;
+        uint64_t chunkTableOffset;
+        uint64_t tilesOffset;
+        uint64_t spawnsOffset;
+        uint64_t fileSize;
+    };
+    static_assert(sizeof(LevelHeader) == 64);
+
+    // Entity placed when the level starts; (x, y) is the entity's top-left corner in world pixels
+    struct LevelSpawn
+    {
+        float x = 0.0f, y = 0.0f;
+        EntityKind kind = EntityKind::ENTITY_ENEMY;
+        uint8_t reserved[3] = {};
+    };
+    static_assert(sizeof(LevelSpawn) == 12);
+
+    /**
+     * @brief A binary level file mapped into memory and used in place.
+     *
+     * open() maps the file and checks the header and section bounds, which is O(1) in the level
+     * size; tiles are never parsed or copied. The tilemap returned by createTilemap() reads the
+     * mapped tiles directly and keeps the mapping alive, so the Level object itself can go away.
+     * Tile bytes are trusted as written by the level converter.
+     */
+    class Level
+    {
+    public:
+        /**
+         * @brief Maps and validates a level file.
+         *
+         * @return false if the file cannot be mapped or is not a valid level of this version (logged).
+         */
+        bool open(const std::string &path);
+
+        /**
+         * @brief Tilemap viewing the mapped tiles; copies them only if it is edited.
+         */
+        Tilemap createTilemap() const;
+
+        std::span<const LevelSpawn> getSpawns() const;
+
+        int getWidthInChunks() const { return m_header ? (int)m_header->widthInChunks : 0; }
+        int getHeightInChunks() const { return m_header ? (int)m_header->heightInChunks : 0; }
+
+    private:
+        std::shared_ptr<const Utils::MappedFile> m_file;
+        const LevelHeader *m_header = nullptr;
+    };
+
+    /**
+     * @brief Writes a tilemap and its spawns as a binary level file.
+     *
+     * @return false if the file cannot be written (logged).
+     */
+    bool writeLevel(const std::string &path, const Tilemap &map, std::span<const LevelSpawn> spawns);
+
+    /**
+     * @brief Spawns for a generated test level: the player on the floor near the left wall and an
+     * enemy at the start of each platform.
+     */
+    std::vector<LevelSpawn> createTestSpawns(const Tilemap &map);
+} // namespace Gameplay
@@ -0,0 +1,36 @@
+#pragma once
+
+#include <cstddef>
+
+#include "Utils/Simd.hpp"
+
+namespace Gameplay
+{
+    // Physics rules shared by every entity in one batch
+    struct MovementParams
+    {
+        float acceleration = 0.0f;
+        float friction = 0.0f;
+        float gravity = 0.0f;
+        float terminalVelocity = 0.0f;
+        float maxSpeed = 0.0f;
+    };
+
+    /**
+     * @brief Applies the PlayerMovement velocity rules to `count` entities at once.
+     *
+     * Per entity: accelerate towards `moveDir` (-1, 0 or +1), apply friction when turning around or
+     * idle, clamp to `maxSpeed`, add gravity and clamp to `terminalVelocity`. Every branch of the
+     * scalar rules is computed and blended with a select, so all ISA variants produce bit-identical
+     * results. Levels the CPU lacks fall back to the next lower one.
+     *
+     * @param level Instruction set to run; use Utils::detectSimdLevel() for the fastest available.
+     * @param params Physics rules for the batch.
+     * @param moveDir Movement intent per entity.
+     * @param velX Horizontal velocities, updated in place.
+     * @param velY Vertical velocities, updated in place.
+     * @param count Number of entities.
+     * @param deltaTime Time step in seconds.
+     */
+    void updateVelocities(Utils::SimdLevel level, const MovementParams &params, const float *moveDir, float *velX, float *velY, size_t count, float deltaTime);
+} // namespace Gameplay
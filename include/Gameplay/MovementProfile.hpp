@@ -0,0 +1,97 @@
+#pragma once
+
+#include <concepts>
+
+#include "Gameplay/MovementKernel.hpp"
+
+#include "Common/Constants.hpp"
+
+namespace Gameplay
+{
+    /**
+     * @brief Physics constants a movement system is specialized on.
+     *
+     * Compile-time profiles declare them as `static constexpr` members, so the movement code reading
+     * them through an empty profile object folds them into immediates. TunableProfile declares
+     * the same names as plain members for runtime editing.
+     */
+    template <typename Profile>
+    concept MovementProfile = requires(const Profile &profile) {
+        { profile.acceleration } -> std::convertible_to<float>;
+        { profile.friction } -> std::convertible_to<float>;
+        { profile.gravity } -> std::convertible_to<float>;
+        { profile.terminalVelocity } -> std::convertible_to<float>;
+        { profile.jumpForce } -> std::convertible_to<float>;
+        { profile.maxSpeed } -> std::convertible_to<float>;
+    };
+
+    struct PlayerProfile
+    {
+        static constexpr float acceleration = Common::PLAYER_ACCELERATION;
+        static constexpr float friction = Common::FRICTION; // higher = less slippery
+        static constexpr float gravity = Common::GRAVITY;
+        static constexpr float terminalVelocity = Common::TERMINAL_VELOCITY;
+        static constexpr float jumpForce = Common::JUMP_FORCE;
+        static constexpr float maxSpeed = Common::PLAYER_MAX_SPEED; // Pixels per second
+    };
+
+    struct EnemyProfile
+    {
+        static constexpr float acceleration = Common::ENEMY_ACCELERATION;
+        static constexpr float friction = Common::ENEMY_FRICTION;
+        static constexpr float gravity = Common::GRAVITY;
+        static constexpr float terminalVelocity = Common::TERMINAL_VELOCITY;
+        static constexpr float jumpForce = Common::ENEMY_JUMP_FORCE; // Only where the flow field says to jump
+        static constexpr float maxSpeed = Common::ENEMY_SPEED;
+    };
+
+    // Projectiles fly straight at launch speed until they hit something or run out of lifetime
+    struct ProjectileProfile
+    {
+        static constexpr float acceleration = 0.0f;
+        static constexpr float friction = 0.0f;
+        static constexpr float gravity = 0.0f;
+        static constexpr float terminalVelocity = 0.0f;
+        static constexpr float jumpForce = 0.0f;
+        static constexpr float maxSpeed = Common::PROJECTILE_SPEED;
+        static constexpr float lifetime = Common::PROJECTILE_LIFETIME;
+    };
+
+    /**
+     * @brief Runtime-editable profile for tuning movement without recompiling.
+     *
+     * Starts out as a copy of the player profile; every update reloads the values from memory, so
+     * this costs a few loads per entity compared to a compile-time profile.
+     */
+    struct TunableProfile
+    {
+        float acceleration = PlayerProfile::acceleration;
+        float friction = PlayerProfile::friction;
+        float gravity = PlayerProfile::gravity;
+        float terminalVelocity = PlayerProfile::terminalVelocity;
+        float jumpForce = PlayerProfile::jumpForce;
+        float maxSpeed = PlayerProfile::maxSpeed;
+
+        /**
+         * @brief Copies the values of a compile-time profile, e.g. to start tuning the enemies.
+         */
+        template <MovementProfile Profile>
+        static constexpr TunableProfile from()
+        {
+            return {Profile::acceleration, Profile::friction, Profile::gravity, Profile::terminalVelocity, Profile::jumpForce,
+                    Profile::maxSpeed};
+        }
+    };
+
+    static_assert(MovementProfile<PlayerProfile> && MovementProfile<EnemyProfile> && MovementProfile<ProjectileProfile> &&
+                  MovementProfile<TunableProfile>);
+
+    /**
+     * @brief Batch parameters for updateVelocities(); jumping is not part of the vectorized rules.
+     */
+    template <MovementProfile Profile>
+    constexpr MovementParams toMovementParams(const Profile &profile = {})
+    {
+        return {profile.acceleration, profile.friction, profile.gravity, profile.terminalVelocity, profile.maxSpeed};
+    }
+} // namespace Gameplay
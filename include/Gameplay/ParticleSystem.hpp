@@ -0,0 +1,95 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "Gameplay/Camera.hpp"
+
+#include "Utils/FrameArena.hpp"
+
+#include "Common/Types.hpp"
+#include "Common/Constants.hpp"
+
+namespace Gameplay
+{
+    // One emission: `count` particles leaving (x, y) in a cone, with randomized speed and lifetime
+    struct ParticleBurst
+    {
+        int count = 0;
+        float speedMin = 0.0f, speedMax = 0.0f; // Pixels per second
+        float angle = 0.0f;                     // Cone direction in radians; 0 points right, positive angles point down
+        float spread = 0.0f;                    // Cone half-angle in radians
+        float lifeMin = 0.0f, lifeMax = 0.0f;   // Seconds
+        float gravity = 0.0f;                   // Downward acceleration, pixels per second squared
+        float size = 0.0f;                      // Edge of the square in pixels
+        uint32_t color = 0xFFFFFFFF;            // 0xRRGGBBAA; alpha fades out over the lifetime
+    };
+
+    // Impact of a projectile on a wall, sprayed back towards the shooter
+    inline constexpr ParticleBurst HIT_SPARKS = {12, 150.0f, 450.0f, 3.14159265f, 1.1f, 0.15f, 0.35f, 900.0f, 4.0f, 0xFFDC40FF};
+    // Player touching the ground after a fall, kicked up to both sides
+    inline constexpr ParticleBurst LANDING_DUST = {16, 40.0f, 140.0f, -1.5707963f, 1.4f, 0.25f, 0.5f, 200.0f, 5.0f, 0xA08C78C0};
+    // Emitted by every live projectile each step
+    inline constexpr ParticleBurst PROJECTILE_TRAIL = {1, 0.0f, 30.0f, 0.0f, 3.14159265f, 0.1f, 0.25f, 0.0f, 3.0f, 0xFFF0A0B0};
+
+    /**
+     * @brief Fixed-capacity pool of short-lived, purely visual particles.
+     *
+     * Particles are stored as parallel columns, densely packed: removal moves the last particle into
+     * the freed slot, so iteration never skips holes. update() integrates every live particle with
+     * branch-free arithmetic over the columns (auto-vectorized), then compacts away the expired ones.
+     * Storage is allocated once; emissions past the capacity are dropped and counted.
+     *
+     * Particles are cosmetic: they never affect entities and are not part of the world's state hash.
+     */
+    class ParticleSystem
+    {
+    public:
+        explicit ParticleSystem(size_t capacity = (size_t)Common::PARTICLE_CAPACITY);
+
+        /**
+         * @brief Spawns a burst at (`x`, `y`); `mirrored` flips it horizontally (e.g. for a left-facing source).
+         *
+         * @return Number of particles actually spawned.
+         */
+        size_t emit(const ParticleBurst &burst, float x, float y, bool mirrored = false);
+
+        /**
+         * @brief Advances every particle by `deltaTime` and removes those whose lifetime ran out.
+         */
+        void update(float deltaTime);
+
+        /**
+         * @brief Appends one screen-space instance per particle inside the camera.
+         *
+         * Positions are interpolated back along the velocity by the part of the step not yet
+         * elapsed, to match the entities' render interpolation.
+         *
+         * @param alpha Fraction of a simulation step elapsed since the last step, in [0, 1].
+         */
+        void collectInstances(const Camera &camera, float alpha, Utils::FrameVector<Common::ParticleInstance> &out) const;
+
+        void clear() { m_count = 0; }
+
+        size_t size() const { return m_count; }
+        size_t capacity() const { return m_capacity; }
+        uint64_t getDroppedCount() const { return m_dropped; }
+
+    private:
+        float nextRandom(); // Uniform in [0, 1)
+
+        size_t m_capacity;
+        size_t m_count = 0;
+        uint64_t m_dropped = 0;
+        uint32_t m_randomState = 0x9E3779B9u; // Fixed seed, so replays look the same
+
+        std::vector<float> m_posX, m_posY;
+        std::vector<float> m_velX, m_velY;
+        std::vector<float> m_gravity;
+        std::vector<float> m_life;         // Seconds left
+        std::vector<float> m_inverseLife;  // 1 / initial lifetime, for the fade
+        std::vector<float> m_size;
+        std::vector<uint32_t> m_color;
+    };
+} // namespace Gameplay
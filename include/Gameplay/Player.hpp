@@ -1,6 +1,9 @@
 #pragma once
 
 #include "Gameplay/PlayerMovement.hpp"
+#include "Gameplay/EntityStore.hpp"
+#include "Gameplay/Tilemap.hpp"
+#include "Gameplay/WorldSnapshot.hpp"
 
 #include "Common/Types.hpp"
 #include "Common/Constants.hpp"
@@ -11,25 +14,44 @@ namespace Gameplay
     {
     public:
         /**
-         * @brief Update the player's position based on input and elapsed time, clamping it to the screen area.
+         * @brief Creates the player's entity at a world position (top-left corner).
          *
-         * Moves the player by a fixed speed (400 pixels per second) scaled by `deltaTime` when the corresponding
-         * direction flags in `input` are set, then clamps the resulting position so the player remains fully
-         * within [0, SCREEN_WIDTH - WIDTH] horizontally and [0, SCREEN_HEIGHT - HEIGHT] vertically.
+         * @param entities Store the player entity is created in.
+         * @param x World x coordinate.
+         * @param y World y coordinate.
+         */
+        void spawn(EntityStore &entities, float x, float y);
+
+        /**
+         * @brief Update the player's entity based on input and elapsed time, colliding with the tile grid.
+         *
+         * Runs the movement system on the player's entity, and fires a projectile in the facing direction
+         * while `attack` is held, at most once per Common::ATTACK_COOLDOWN.
          *
          * @param deltaTime Time elapsed since the last update, in seconds.
-         * @param input Structure containing directional input flags (`up`, `down`, `left`, `right`).
+         * @param input Structure containing directional input flags (`left`, `right`, `jump`, `attack`).
+         * @param map Tile grid the player collides with.
+         * @param entities Store holding the player's entity; projectiles are spawned into it.
          */
-        void update(float deltaTime, const Common::InputState &input);
+        void update(float deltaTime, const Common::InputState &input, const Tilemap &map, EntityStore &entities);
+
+        EntityHandle getHandle() const { return m_handle; }
 
         /**
-         * @brief Builds a render command for the player using its current position, size, and player texture.
-         *
-         * @return Common::RenderCommand A command containing position (x, y), size (width, height), and the `Common::TextureID::TEX_PLAYER` texture identifier.
+         * @brief Whether the last update() fired a projectile.
+         */
+        bool firedThisStep() const { return m_firedThisStep; }
+
+        /**
+         * @brief Appends the player's own state (entity handle, attack cooldown) to `out`; the entity itself is saved with the store.
          */
-        Common::RenderCommand getRenderCommand() const;
+        void save(WorldSnapshot &out) const;
+        bool load(SnapshotReader &in);
 
     private:
         PlayerMovement movement;
+        EntityHandle m_handle;
+        float m_attackCooldown = 0.0f;
+        bool m_firedThisStep = false; // Recomputed every update(), so not part of the snapshot
     };
-} // namespace Gameplay
\ No newline at end of file
+} // namespace Gameplay
@@ -1,27 +1,45 @@
 #pragma once
 
+#include <type_traits>
+
+#include "Gameplay/EntityStore.hpp"
+#include "Gameplay/MovementProfile.hpp"
+#include "Gameplay/Tilemap.hpp"
+
 #include "Common/Types.hpp"
 #include "Common/Constants.hpp"
 
 namespace Gameplay
 {
-    class PlayerMovement
+    /**
+     * @brief Movement system for input-driven entities; all state lives in the EntityStore columns.
+     *
+     * The physics constants come from `Profile`. With a compile-time profile the object is empty and
+     * the constants are folded into update(); with TunableProfile it holds one editable copy.
+     * update() is explicitly instantiated for PlayerProfile and TunableProfile in PlayerMovement.cpp;
+     * add an instantiation there for any other profile.
+     */
+    template <MovementProfile Profile>
+    class BasicPlayerMovement
     {
-    private:
-        const float acceleration = Common::PLAYER_ACCELERATION;
-        const float friction = Common::FRICTION; // higher = less slippery
-        const float gravity = Common::GRAVITY;
-        const float terminalVelocity = Common::TERMINAL_VELOCITY;
-        const float jumpForce = Common::JUMP_FORCE;
-        const float maxSpeed = Common::PLAYER_MAX_SPEED; // Pixels per second
+    public:
+        BasicPlayerMovement() = default;
+        explicit BasicPlayerMovement(const Profile &profile) : m_profile(profile) {}
 
-        float m_x = 0, m_y = 0;
-        float m_velocityX = 0, m_velocityY = 0;
-        bool m_canJump = false;
+        void update(EntityStore &entities, EntityHandle handle, float deltaTime, const Common::InputState &input, const Tilemap &map) const;
 
-    public:
-        void update(float deltaTime, const Common::InputState &input);
+        const Profile &getProfile() const { return m_profile; }
+        void setProfile(const Profile &profile) { m_profile = profile; }
 
-        Common::RenderCommand getRenderCommand() const;
+    private:
+        [[no_unique_address]] Profile m_profile;
     };
-};
+
+    using PlayerMovement = BasicPlayerMovement<PlayerProfile>;
+    using TunablePlayerMovement = BasicPlayerMovement<TunableProfile>;
+
+    extern template class BasicPlayerMovement<PlayerProfile>;
+    extern template class BasicPlayerMovement<TunableProfile>;
+
+    static_assert(std::is_empty_v<PlayerMovement> && std::is_copy_assignable_v<PlayerMovement>);
+} // namespace Gameplay
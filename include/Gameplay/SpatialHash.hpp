@@ -0,0 +1,94 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "Gameplay/Collision.hpp"
+#include "Gameplay/EntityStore.hpp"
+
+#include "Common/Constants.hpp"
+
+namespace Gameplay
+{
+    /**
+     * @brief Broad-phase uniform grid over entity boxes, hashed into a flat bucket table.
+     *
+     * build() rebuilds the whole structure from the position and size columns with a counting sort
+     * (two linear passes, no per-cell allocations). Each box is stored once, in the cell holding its
+     * top-left corner; queries widen their cell range by the largest box size seen, so boxes
+     * spanning several cells are still found, and never twice.
+     *
+     * Queries write dense entity indices into a caller-provided buffer and never allocate. They
+     * return the total number of matches, which can exceed the buffer capacity; only the first
+     * `capacity` are written. Results are in no particular order. The hash reflects the positions
+     * at the last build() and must be rebuilt after entities move, are created or are destroyed.
+     */
+    class SpatialHash
+    {
+    public:
+        /**
+         * @param cellSize Cell edge in world pixels; a multiple of Common::TILE_SIZE around the size of a typical entity.
+         */
+        explicit SpatialHash(float cellSize = (float)Common::SPATIAL_CELL_SIZE);
+
+        /**
+         * @brief Rebuilds the grid from flat columns of `count` boxes (top-left corner and size).
+         */
+        void build(const float *x, const float *y, const float *width, const float *height, size_t count);
+
+        /**
+         * @brief Rebuilds the grid from every entity in the store, indexed by dense index.
+         */
+        void build(const EntityStore &entities);
+
+        /**
+         * @brief Boxes overlapping `box` (touching edges do not count).
+         */
+        size_t queryAABB(const AABB &box, uint32_t *out, size_t capacity) const;
+
+        /**
+         * @brief Boxes with any point within `radius` of (`centerX`, `centerY`).
+         */
+        size_t queryRadius(float centerX, float centerY, float radius, uint32_t *out, size_t capacity) const;
+
+        /**
+         * @brief Boxes crossed by the segment from (`originX`, `originY`) along (`directionX`, `directionY`) for `maxDistance`.
+         *
+         * The direction does not need to be normalized; `maxDistance` is measured in its length units.
+         */
+        size_t queryRay(float originX, float originY, float directionX, float directionY, float maxDistance, uint32_t *out,
+                        size_t capacity) const;
+
+        size_t size() const { return m_entries.size(); }
+        float getCellSize() const { return m_cellSize; }
+
+    private:
+        struct Entry
+        {
+            float x, y, width, height;
+            uint32_t index;
+            int32_t cellX, cellY; // Exact cell, since several cells can share a bucket
+        };
+
+        int32_t cellOf(float coordinate) const;
+        size_t bucketOf(int32_t cellX, int32_t cellY) const;
+
+        /**
+         * @brief Calls `test` on every stored box whose cell can hold a box overlapping [minX, maxX] x [minY, maxY].
+         */
+        template <typename Test>
+        size_t gather(float minX, float minY, float maxX, float maxY, uint32_t *out, size_t capacity, const Test &test) const;
+
+        float m_cellSize;
+        float m_inverseCellSize;
+        float m_maxWidth = 0.0f;  // Largest box in the last build; widens query ranges to the left
+        float m_maxHeight = 0.0f; // ... and upwards
+        size_t m_bucketMask = 0;
+
+        std::vector<uint32_t> m_bucketStart; // Entries of bucket b are [m_bucketStart[b], m_bucketStart[b + 1])
+        std::vector<uint32_t> m_cursor;      // Write positions during build()
+        std::vector<Entry> m_entries;        // Grouped by bucket
+        std::vector<uint32_t> m_entryBucket; // Bucket of each input box, kept between build passes
+    };
+} // namespace Gameplay
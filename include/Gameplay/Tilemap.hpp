@@ -0,0 +1,122 @@
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#include "Gameplay/Camera.hpp"
+
+#include "Utils/FrameArena.hpp"
+
+#include "Common/Types.hpp"
+#include "Common/Constants.hpp"
+
+namespace Gameplay
+{
+    enum class TileType : uint8_t
+    {
+        TILE_EMPTY = 0,
+        TILE_WALL = 1,
+        TILE_FLOOR = 2
+    };
+
+    struct ChunkCoord
+    {
+        int x = 0, y = 0;
+    };
+
+    /**
+     * @brief Tile grid stored as fixed-size chunks of Common::CHUNK_SIZE x Common::CHUNK_SIZE tiles.
+     *
+     * Tiles of one chunk are contiguous (chunk-major layout), so visiting a visible chunk touches a
+     * single block of memory and chunks outside the camera are never looked at.
+     *
+     * The tiles and per-chunk counts either live in the map's own storage or, for a level loaded
+     * from a binary level file (see Gameplay::Level), are read in place from the file's mapping.
+     * A mapped map is copied into its own storage on the first setTile().
+     */
+    class Tilemap
+    {
+    public:
+        Tilemap(int widthInChunks, int heightInChunks);
+
+        /**
+         * @brief Wraps existing chunk-major tiles and per-chunk counts without copying them.
+         *
+         * @param tiles Common::CHUNK_SIZE squared tiles per chunk, chunks in row-major order.
+         * @param chunkTileCounts Non-empty tile count of each chunk; must match `tiles`.
+         * @param mapping Keeps the memory behind `tiles` and `chunkTileCounts` alive for as long as any copy of the map.
+         */
+        Tilemap(int widthInChunks, int heightInChunks, const TileType *tiles, const uint16_t *chunkTileCounts,
+                std::shared_ptr<const void> mapping);
+
+        int getWidthInChunks() const { return m_widthInChunks; }
+        int getHeightInChunks() const { return m_heightInChunks; }
+        int getWidthInTiles() const { return m_widthInChunks * Common::CHUNK_SIZE; }
+        int getHeightInTiles() const { return m_heightInChunks * Common::CHUNK_SIZE; }
+        float getPixelWidth() const { return (float)(m_widthInChunks * Common::CHUNK_PIXELS); }
+        float getPixelHeight() const { return (float)(m_heightInChunks * Common::CHUNK_PIXELS); }
+
+        /**
+         * @brief Returns the tile at a tile coordinate; anything outside the map reads as a wall.
+         */
+        TileType getTile(int tileX, int tileY) const;
+        void setTile(int tileX, int tileY, TileType type);
+
+        /**
+         * @brief Appends screen-space commands for the tiles of one chunk that are inside the camera.
+         *
+         * Reads tile data only, so different chunks can be processed on different threads.
+         */
+        void collectChunkCommands(ChunkCoord chunk, const Camera &camera, Utils::FrameVector<Common::RenderCommand> &out) const;
+
+        /**
+         * @brief Appends a static-layer command for every non-empty chunk intersecting the camera, row by row.
+         *
+         * Only chunks intersecting the viewport are visited, and chunks without any tiles are skipped
+         * outright, so the cost depends on the viewport size rather than the map size.
+         */
+        void collectStaticChunks(const Camera &camera, Utils::FrameVector<Common::StaticChunkCommand> &out) const;
+
+        /**
+         * @brief Appends commands for every tile of one chunk, relative to the chunk's top-left corner.
+         *
+         * Used by the renderer to rebuild the chunk's cached texture.
+         */
+        void collectChunkLocalCommands(ChunkCoord chunk, Utils::FrameVector<Common::RenderCommand> &out) const;
+
+        /**
+         * @brief Counter bumped by every setTile() that changes a tile of the chunk.
+         */
+        uint32_t getChunkVersion(ChunkCoord chunk) const;
+
+        /**
+         * @brief Builds a bordered test level with a floor and scattered platforms.
+         */
+        static Tilemap createTestLevel(int widthInChunks, int heightInChunks);
+
+        // Raw chunk-major storage, as written to level files
+        const TileType *getTileData() const { return m_mappedTiles ? m_mappedTiles : m_tiles.data(); }
+        const uint16_t *getChunkTileCounts() const { return m_mappedTiles ? m_mappedChunkTileCount : m_chunkTileCount.data(); }
+        bool isMapped() const { return m_mappedTiles != nullptr; }
+
+    private:
+        size_t tileIndex(int tileX, int tileY) const;
+
+        /**
+         * @brief Copies mapped tiles and counts into the map's own storage before the first edit.
+         */
+        void detachMapping();
+
+        int m_widthInChunks;
+        int m_heightInChunks;
+        std::vector<TileType> m_tiles;          // Chunk-major tile storage; empty while mapped
+        std::vector<uint16_t> m_chunkTileCount; // Non-empty tiles per chunk; empty while mapped
+        std::vector<uint32_t> m_chunkVersion;   // Edit counter per chunk, for render caches
+
+        // Level-file views used instead of the vectors above until the first edit
+        const TileType *m_mappedTiles = nullptr;
+        const uint16_t *m_mappedChunkTileCount = nullptr;
+        std::shared_ptr<const void> m_mapping;
+    };
+} // namespace Gameplay
@@ -0,0 +1,159 @@
+#pragma once
+
+#include <cstdint>
+#include <span>
+#include <vector>
+
+#include "Gameplay/Player.hpp"
+#include "Gameplay/EntityStore.hpp"
+#include "Gameplay/EntitySystems.hpp"
+#include "Gameplay/FlowField.hpp"
+#include "Gameplay/Tilemap.hpp"
+#include "Gameplay/Camera.hpp"
+#include "Gameplay/SpatialHash.hpp"
+#include "Gameplay/ParticleSystem.hpp"
+#include "Gameplay/Level.hpp"
+#include "Gameplay/WorldSnapshot.hpp"
+
+#include "Utils/JobSystem.hpp"
+#include "Utils/FrameArena.hpp"
+
+#include "Common/Types.hpp"
+
+namespace Gameplay
+{
+    // Owns all simulation state and runs the systems in order for each fixed step
+    class World
+    {
+    public:
+        /**
+         * @brief Builds the generated test level.
+         */
+        World();
+
+        /**
+         * @brief Plays a loaded level: its tiles are used in place and its spawn table placed.
+         */
+        explicit World(const Level &level);
+
+        World(const World &) = delete;
+        World &operator=(const World &) = delete;
+
+        /**
+         * @brief Spreads stepping and render-command building over a worker pool; nullptr runs everything inline.
+         *
+         * The pool must outlive the world (or be detached first).
+         */
+        void setJobSystem(Utils::JobSystem *jobs);
+
+        /**
+         * @brief Advances the simulation by exactly one Common::TIME_STEP.
+         */
+        void step(const Common::InputState &input);
+
+        /**
+         * @brief Moves the camera to the interpolated player and appends the frame's screen-space commands.
+         *
+         * Tiles are not emitted one by one: each visible chunk becomes a single static-layer command
+         * that the renderer draws from its chunk texture cache.
+         *
+         * @param alpha Fraction of a simulation step elapsed since the last step, in [0, 1].
+         * @param out Command list the entity commands are appended to. With a worker pool, the
+         * per-job buckets allocate from the same arena as `out`.
+         * @param staticOut List the visible chunks' static-layer commands are appended to.
+         */
+        void collectRenderCommands(float alpha, Utils::FrameVector<Common::RenderCommand> &out,
+                                   Utils::FrameVector<Common::StaticChunkCommand> &staticOut);
+
+        /**
+         * @brief Appends the live particles as screen-space instances, culled against the camera.
+         *
+         * Uses the camera placed by the last collectRenderCommands() call, so call it after that.
+         */
+        void collectParticles(float alpha, Utils::FrameVector<Common::ParticleInstance> &out) const;
+
+        /**
+         * @brief Player center and velocity after the last step, for streaming chunks ahead of it; zero without a player.
+         */
+        Common::StreamFocus getStreamFocus() const;
+
+        /**
+         * @brief Hashes the simulation state (every entity column in dense order) for determinism checks.
+         *
+         * Two runs fed the same per-step inputs must produce the same hash, whatever the worker count.
+         */
+        uint64_t computeStateHash() const;
+
+        /**
+         * @brief Overwrites `out` with the simulation state: every entity column, the slot tables and the player's state.
+         *
+         * Tiles are not included (the simulation never edits them), nor are particles, which are
+         * cosmetic. Two worlds on the same level that restore the same snapshot step identically.
+         */
+        void saveSnapshot(WorldSnapshot &out) const;
+
+        /**
+         * @brief Returns to the state of a saveSnapshot() of this world or one on the same level.
+         *
+         * Live particles are dropped and the spatial hash is rebuilt from the restored entities.
+         * Must not run during step().
+         *
+         * @return false if the snapshot is truncated; the world is then left in an unspecified state.
+         */
+        bool restoreSnapshot(const WorldSnapshot &snapshot);
+
+        const Tilemap &getLevel() const { return m_level; }
+        const EntityStore &getEntities() const { return m_entities; }
+        EntityStore &getEntities() { return m_entities; }
+
+        /**
+         * @brief Broad-phase grid over every entity, rebuilt by each step() and restoreSnapshot(); query results are dense indices.
+         */
+        const SpatialHash &getSpatialHash() const { return m_spatialHash; }
+
+        const ParticleSystem &getParticles() const { return m_particles; }
+
+        /**
+         * @brief Shots, landings and projectile impacts of the last step(), panned by where they happened relative to the player.
+         */
+        std::span<const Common::SoundEvent> getSoundEvents() const { return m_soundEvents; }
+
+        /**
+         * @brief Path field toward the player's feet that enemies follow; retargeted each step() before the enemies move.
+         */
+        const FlowField &getFlowField() const { return m_flowField; }
+
+    private:
+        void spawnEntities(std::span<const LevelSpawn> spawns);
+        bool isPlayerOnGround() const;
+        void removeSpent();
+
+        /**
+         * @brief Points the flow field at the player's feet; rebuilds it only when they are over another tile.
+         */
+        void updateFlowField();
+
+        /**
+         * @brief Emits landing dust, projectile trails and impact sparks (plus the step's sound events), then advances the particles.
+         *
+         * Runs after the player and projectiles moved and hit enemies, and before spent projectiles are removed.
+         */
+        void updateEffects();
+
+        Tilemap m_level;
+        EntityStore m_entities;
+        Player m_player;
+        Camera m_camera;
+        SystemScratch m_scratch;
+        SpatialHash m_spatialHash;
+        FlowField m_flowField;
+        ParticleSystem m_particles;
+        bool m_playerWasOnGround = false; // Player's ground contact before this step's update, for landing effects
+        std::vector<Common::SoundEvent> m_soundEvents; // Rewritten by every step; not part of the snapshot
+
+        Utils::JobSystem *m_jobs = nullptr;
+        Utils::TaskGraph m_stepGraph;
+        Common::InputState m_stepInput;
+        std::vector<Utils::FrameVector<Common::RenderCommand>> m_commandBuckets; // One per parallel job, merged in order; storage comes from the output's arena
+    };
+} // namespace Gameplay
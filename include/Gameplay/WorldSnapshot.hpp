@@ -0,0 +1,202 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+#include <vector>
+
+#include "Common/Constants.hpp"
+
+namespace Gameplay
+{
+    // Unit of change tracking: snapshots are compared and delta-encoded in blocks of this many bytes
+    inline constexpr size_t SNAPSHOT_BLOCK_SIZE = 64;
+    // Columns are padded to a multiple of this many elements, so a spawn or despawn does not shift every later column
+    inline constexpr size_t SNAPSHOT_COLUMN_GRAIN = 256;
+
+    /**
+     * @brief Gameplay state flattened into one contiguous, memcpy-able byte buffer.
+     *
+     * Written by World::saveSnapshot() and read back by World::restoreSnapshot(). Every column
+     * starts on a SNAPSHOT_BLOCK_SIZE boundary and padding is zeroed, so two snapshots of similar
+     * states share most of their blocks byte for byte. The buffer is kept between writes; steady
+     * state saving does not allocate.
+     */
+    class WorldSnapshot
+    {
+    public:
+        const uint8_t *data() const { return m_bytes.data(); }
+        uint8_t *data() { return m_bytes.data(); }
+        size_t size() const { return m_size; }
+        bool empty() const { return m_size == 0; }
+
+        void clear() { m_size = 0; }
+
+        /**
+         * @brief Sets the size, keeping the first `size` bytes; new bytes are uninitialized.
+         */
+        void resize(size_t size);
+
+        /**
+         * @brief Grows the snapshot by `bytes` and returns where they go.
+         */
+        uint8_t *append(size_t bytes)
+        {
+            const size_t offset = m_size;
+            resize(m_size + bytes);
+            return m_bytes.data() + offset;
+        }
+
+        /**
+         * @brief Zero-pads to the next SNAPSHOT_BLOCK_SIZE boundary.
+         */
+        void alignToBlock()
+        {
+            const size_t padding = (SNAPSHOT_BLOCK_SIZE - m_size % SNAPSHOT_BLOCK_SIZE) % SNAPSHOT_BLOCK_SIZE;
+            std::memset(append(padding), 0, padding);
+        }
+
+        template <typename T>
+        void write(const T &value)
+        {
+            static_assert(std::is_trivially_copyable_v<T>);
+            std::memcpy(append(sizeof(T)), &value, sizeof(T));
+        }
+
+        /**
+         * @brief Writes a block-aligned column holding `column` padded with zeros to a multiple of SNAPSHOT_COLUMN_GRAIN elements.
+         */
+        template <typename T>
+        void writeColumn(const std::vector<T> &column)
+        {
+            static_assert(std::is_trivially_copyable_v<T>);
+            const size_t bytes = column.size() * sizeof(T);
+            const size_t stride = paddedCount(column.size()) * sizeof(T);
+            uint8_t *out = append(stride);
+            if (bytes > 0)
+                std::memcpy(out, column.data(), bytes);
+            std::memset(out + bytes, 0, stride - bytes);
+            alignToBlock();
+        }
+
+        static size_t paddedCount(size_t count)
+        {
+            return (count + SNAPSHOT_COLUMN_GRAIN - 1) / SNAPSHOT_COLUMN_GRAIN * SNAPSHOT_COLUMN_GRAIN;
+        }
+
+    private:
+        std::vector<uint8_t> m_bytes; // Only grows; the first m_size bytes are the snapshot
+        size_t m_size = 0;
+    };
+
+    /**
+     * @brief Reads a WorldSnapshot back in the order it was written; every read fails past the end.
+     */
+    class SnapshotReader
+    {
+    public:
+        explicit SnapshotReader(const WorldSnapshot &snapshot) : m_data(snapshot.data()), m_size(snapshot.size()) {}
+
+        template <typename T>
+        bool read(T &value)
+        {
+            static_assert(std::is_trivially_copyable_v<T>);
+            const uint8_t *in = take(sizeof(T));
+            if (!in)
+                return false;
+            std::memcpy(&value, in, sizeof(T));
+            return true;
+        }
+
+        /**
+         * @brief Replaces `column` with the `count` elements of a column written by WorldSnapshot::writeColumn().
+         */
+        template <typename T>
+        bool readColumn(std::vector<T> &column, size_t count)
+        {
+            static_assert(std::is_trivially_copyable_v<T>);
+            const uint8_t *in = take(WorldSnapshot::paddedCount(count) * sizeof(T));
+            if (!in || !alignToBlock())
+                return false;
+            column.resize(count);
+            if (count > 0)
+                std::memcpy(column.data(), in, count * sizeof(T));
+            return true;
+        }
+
+        bool alignToBlock() { return take((SNAPSHOT_BLOCK_SIZE - m_offset % SNAPSHOT_BLOCK_SIZE) % SNAPSHOT_BLOCK_SIZE) != nullptr; }
+
+    private:
+        const uint8_t *take(size_t bytes)
+        {
+            if (bytes > m_size - m_offset)
+                return nullptr;
+            const uint8_t *in = m_data + m_offset;
+            m_offset += bytes;
+            return in;
+        }
+
+        const uint8_t *m_data;
+        size_t m_size;
+        size_t m_offset = 0;
+    };
+
+    /**
+     * @brief Ring of the last `capacity` world snapshots, delta-compressed against each other.
+     *
+     * Only the newest snapshot is stored whole. Each older one is kept as a reverse delta: the
+     * blocks that differ from the snapshot after it, plus its size. Blocks of data that did not
+     * change in a step (sizes, textures, kinds, slot tables, resting entities) cost nothing.
+     * push() finds and copies the changed blocks in one pass over both buffers; rollBack() copies
+     * the stored blocks back. Pushing past the capacity forgets the oldest frame.
+     */
+    class SnapshotHistory
+    {
+    public:
+        explicit SnapshotHistory(size_t capacity = (size_t)Common::SNAPSHOT_HISTORY_FRAMES);
+
+        /**
+         * @brief Makes `snapshot` the newest frame, keeping the previous newest as a delta.
+         */
+        void push(const WorldSnapshot &snapshot);
+
+        /**
+         * @brief Forgets the newest `frames` frames, making the one `frames` pushes back the newest.
+         *
+         * @return false, with nothing changed, if fewer than `frames` + 1 frames are stored.
+         */
+        bool rollBack(size_t frames);
+
+        /**
+         * @brief Last pushed (or rolled back to) snapshot; empty before the first push.
+         */
+        const WorldSnapshot &newest() const { return m_newest; }
+
+        void clear();
+
+        // Frames stored, the newest included
+        size_t size() const { return m_newest.empty() ? 0 : m_deltaCount + 1; }
+        size_t capacity() const { return m_deltas.size() + 1; }
+
+        /**
+         * @brief Bytes of changed blocks held for the older frames (the newest snapshot not included).
+         */
+        size_t getDeltaBytes() const;
+
+    private:
+        // Turns the snapshot after it back into the earlier one
+        struct Delta
+        {
+            size_t size = 0;              // Size of the earlier snapshot
+            size_t changedBlocks = 0;     // Blocks that differ; the vectors below are reused and may be longer
+            std::vector<uint32_t> blocks; // Indices of the blocks that differ, ascending
+            std::vector<uint8_t> bytes;   // The earlier snapshot's content of those blocks
+        };
+
+        WorldSnapshot m_newest;
+        std::vector<Delta> m_deltas; // Ring; storage of overwritten deltas is reused
+        size_t m_nextDelta = 0;      // Slot the next push writes
+        size_t m_deltaCount = 0;
+    };
+} // namespace Gameplay
@@ -0,0 +1,45 @@
+#pragma once
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+namespace Utils
+{
+    // Frames covered by the rolling statistics
+    inline constexpr size_t FPS_WINDOW_FRAMES = 256;
+
+    struct FrameStats
+    {
+        size_t frames = 0;             // Frames in the window (at most FPS_WINDOW_FRAMES)
+        double averageFps = 0.0;       // Frames divided by the time they took
+        double onePercentLowFps = 0.0; // Average rate over the slowest 1% of frames (at least one frame)
+        double averageMs = 0.0;
+        double minMs = 0.0;
+        double maxMs = 0.0;
+        double varianceMs2 = 0.0;      // Frame-time variance in ms^2
+    };
+
+    /**
+     * @brief Rolling-window frame-time statistics.
+     *
+     * addFrame() is O(1): it keeps running sums for the mean and variance. getStats() scans the
+     * window for min/max and the 1% lows, so call it at display rate (e.g. once a second), not per
+     * frame. Nothing allocates after construction.
+     */
+    class FpsCounter
+    {
+    public:
+        void addFrame(uint64_t frameNs);
+        FrameStats getStats() const;
+
+    private:
+        std::array<uint64_t, FPS_WINDOW_FRAMES> m_samples{};
+        size_t m_next = 0;
+        size_t m_count = 0;
+        // Sums over the window in ms; the square sum is double so the variance keeps precision
+        double m_sum = 0.0;
+        double m_sumSquares = 0.0;
+        // Scratch for the partial sort behind the 1% lows
+        mutable std::array<uint64_t, FPS_WINDOW_FRAMES> m_sorted{};
+    };
+} // namespace Utils
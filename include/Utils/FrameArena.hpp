@@ -0,0 +1,113 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <type_traits>
+#include <vector>
+
+namespace Utils
+{
+    struct ArenaStats
+    {
+        size_t capacity = 0;
+        size_t used = 0;                // Bytes handed out from the arena block since the last reset
+        size_t highWaterMark = 0;       // Largest `used` seen at any reset
+        size_t overflowAllocations = 0; // Allocations that did not fit and went to the heap (total)
+        size_t overflowBytes = 0;
+    };
+
+    /**
+     * @brief Linear (bump) allocator for data that lives for one frame.
+     *
+     * Allocation is a single atomic add, so jobs on several threads can allocate from the same
+     * arena. Nothing is freed individually; reset() rewinds the whole arena in O(1). Requests that
+     * do not fit fall back to the heap and are released on the next reset().
+     */
+    class FrameArena
+    {
+    public:
+        explicit FrameArena(size_t capacity);
+        ~FrameArena();
+
+        FrameArena(const FrameArena &) = delete;
+        FrameArena &operator=(const FrameArena &) = delete;
+
+        /**
+         * @brief Returns `size` bytes aligned to `alignment` (a power of two), valid until the next reset().
+         */
+        void *allocate(size_t size, size_t alignment);
+
+        /**
+         * @brief Invalidates every allocation and rewinds the arena. Must not race with allocate().
+         */
+        void reset();
+
+        ArenaStats getStats() const;
+
+    private:
+        struct OverflowBlock
+        {
+            void *memory;
+            size_t alignment;
+        };
+
+        std::byte *m_buffer;
+        size_t m_capacity;
+        std::atomic<size_t> m_offset{0};
+        size_t m_highWaterMark = 0;
+
+        mutable std::mutex m_overflowMutex;
+        std::vector<OverflowBlock> m_overflow;
+        size_t m_overflowAllocations = 0;
+        size_t m_overflowBytes = 0;
+    };
+
+    /**
+     * @brief Standard allocator that draws from a FrameArena; deallocation is a no-op.
+     *
+     * A default-constructed allocator has no arena and uses the regular heap, so containers built on
+     * it also work outside the frame loop (tools, tests, benchmarks).
+     */
+    template <typename T>
+    class FrameAllocator
+    {
+    public:
+        using value_type = T;
+        using propagate_on_container_copy_assignment = std::true_type;
+        using propagate_on_container_move_assignment = std::true_type;
+        using propagate_on_container_swap = std::true_type;
+
+        FrameAllocator() noexcept = default;
+        explicit FrameAllocator(FrameArena *arena) noexcept : m_arena(arena) {}
+
+        template <typename U>
+        FrameAllocator(const FrameAllocator<U> &other) noexcept : m_arena(other.getArena()) {}
+
+        T *allocate(size_t count)
+        {
+            if (!m_arena)
+                return std::allocator<T>().allocate(count);
+            return static_cast<T *>(m_arena->allocate(count * sizeof(T), alignof(T)));
+        }
+
+        void deallocate(T *pointer, size_t count) noexcept
+        {
+            if (!m_arena)
+                std::allocator<T>().deallocate(pointer, count);
+        }
+
+        FrameArena *getArena() const { return m_arena; }
+
+        template <typename U>
+        bool operator==(const FrameAllocator<U> &other) const { return m_arena == other.getArena(); }
+
+    private:
+        FrameArena *m_arena = nullptr;
+    };
+
+    // Vector whose storage comes from a FrameArena; it must not outlive the arena's next reset()
+    template <typename T>
+    using FrameVector = std::vector<T, FrameAllocator<T>>;
+} // namespace Utils
@@ -0,0 +1,63 @@
+#pragma once
+#include <SDL3/SDL.h>
+#include <cstdint>
+
+namespace Utils
+{
+    inline constexpr uint64_t NS_PER_SECOND = 1'000'000'000;
+
+    /**
+     * @brief Monotonic nanosecond clock on SDL_GetPerformanceCounter().
+     *
+     * SDL_GetTicks() only has millisecond resolution, which quantizes frame times at high refresh rates.
+     */
+    class FrameClock
+    {
+    public:
+        FrameClock();
+
+        /**
+         * @brief Current time in nanoseconds since an arbitrary, fixed origin.
+         */
+        static uint64_t nowNs();
+
+        /**
+         * @brief Nanoseconds since the previous tick() (or since construction), then restarts the measurement.
+         */
+        uint64_t tick();
+
+    private:
+        uint64_t m_last;
+    };
+
+    /**
+     * @brief Holds a loop to a target rate by sleeping most of each frame and spinning the rest.
+     *
+     * OS sleeps overshoot by up to a millisecond or two, so wait() sleeps until SPIN_MARGIN_NS before
+     * the deadline and yields in a loop for the remainder. Deadlines advance by a fixed period, so
+     * small overshoots do not accumulate into drift.
+     */
+    class FrameLimiter
+    {
+    public:
+        // Left to the spin loop at the end of each wait
+        static constexpr uint64_t SPIN_MARGIN_NS = 2'000'000;
+
+        /**
+         * @param targetFps Frames per second to hold; 0 or less disables the limiter.
+         */
+        explicit FrameLimiter(double targetFps = 0.0);
+
+        void setTarget(double targetFps);
+        bool isEnabled() const { return m_periodNs != 0; }
+
+        /**
+         * @brief Blocks until the next frame deadline. Returns immediately when disabled or late.
+         */
+        void wait();
+
+    private:
+        uint64_t m_periodNs = 0;
+        uint64_t m_deadline = 0; // 0 until the first wait()
+    };
+} // namespace Utils
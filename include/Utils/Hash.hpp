@@ -0,0 +1,22 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+
+namespace Utils
+{
+    inline constexpr uint64_t FNV_OFFSET_BASIS = 14695981039346656037ull;
+    inline constexpr uint64_t FNV_PRIME = 1099511628211ull;
+
+    /**
+     * @brief 64-bit FNV-1a over a byte range; pass the previous result as `hash` to chain ranges.
+     */
+    inline uint64_t fnv1a(const void *data, size_t size, uint64_t hash = FNV_OFFSET_BASIS)
+    {
+        const unsigned char *bytes = static_cast<const unsigned char *>(data);
+        for (size_t i = 0; i < size; i++)
+        {
+            hash = (hash ^ bytes[i]) * FNV_PRIME;
+        }
+        return hash;
+    }
+} // namespace Utils
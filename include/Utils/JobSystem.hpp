@@ -0,0 +1,128 @@
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace Utils
+{
+    // Number of jobs still outstanding for a group; JobSystem::wait() blocks until it reaches zero
+    struct JobCounter
+    {
+        std::atomic<int> pending{0};
+    };
+
+    /**
+     * @brief Fixed pool of worker threads with one work-stealing deque per worker.
+     *
+     * A worker pushes and pops jobs at the back of its own deque and steals from the front of the
+     * others when it runs dry. Jobs submitted from outside the pool are spread round-robin over the
+     * workers. Threads that wait on a counter run jobs instead of blocking, so nested parallel work
+     * cannot deadlock the pool.
+     */
+    class JobSystem
+    {
+    public:
+        using Job = std::function<void()>;
+
+        /**
+         * @brief Starts the worker threads.
+         *
+         * @param workerCount Number of workers; 0 picks one less than the hardware thread count
+         * (the calling thread helps while it waits), at least one.
+         */
+        explicit JobSystem(unsigned workerCount = 0);
+        ~JobSystem();
+
+        JobSystem(const JobSystem &) = delete;
+        JobSystem &operator=(const JobSystem &) = delete;
+
+        /**
+         * @brief Queues a job. `counter` (optional) is incremented now and decremented when the job finishes.
+         */
+        void submit(Job job, JobCounter *counter = nullptr);
+
+        /**
+         * @brief Runs queued jobs on the calling thread until `counter` reaches zero.
+         */
+        void wait(JobCounter &counter);
+
+        /**
+         * @brief Calls `body(begin, end)` over [0, count) split into ranges of at most `grain` items, in parallel.
+         *
+         * Returns once every range has been processed. Ranges are visited in no particular order.
+         */
+        void parallelFor(size_t count, size_t grain, const std::function<void(size_t, size_t)> &body);
+
+        unsigned getWorkerCount() const { return (unsigned)m_workers.size(); }
+
+    private:
+        struct Task
+        {
+            Job job;
+            JobCounter *counter = nullptr;
+        };
+
+        struct WorkerQueue
+        {
+            std::mutex mutex;
+            std::deque<Task> tasks;
+        };
+
+        void workerLoop(unsigned index);
+        bool tryRunOne(int selfIndex);
+        bool popOrSteal(int selfIndex, Task &task);
+        void run(Task &task);
+
+        std::vector<std::unique_ptr<WorkerQueue>> m_queues;
+        std::vector<std::thread> m_workers;
+        std::atomic<unsigned> m_nextQueue{0};
+        std::atomic<int> m_queuedTasks{0};
+        std::atomic<bool> m_running{true};
+
+        std::mutex m_sleepMutex;
+        std::condition_variable m_wakeCondition;
+    };
+
+    /**
+     * @brief Dependency graph of jobs: each node starts once every node it depends on has finished.
+     */
+    class TaskGraph
+    {
+    public:
+        using NodeId = size_t;
+
+        NodeId add(std::function<void()> job);
+
+        /**
+         * @brief Makes `after` wait for `before` to finish.
+         */
+        void precede(NodeId before, NodeId after);
+
+        /**
+         * @brief Runs the whole graph on `jobs` and returns when every node has finished.
+         *
+         * The graph must be acyclic. It can be run again afterwards.
+         */
+        void run(JobSystem &jobs);
+
+    private:
+        struct Node
+        {
+            std::function<void()> job;
+            std::vector<NodeId> successors;
+            int predecessorCount = 0;
+            std::atomic<int> remaining{0};
+        };
+
+        void schedule(JobSystem &jobs, NodeId id, JobCounter &counter);
+
+        std::deque<Node> m_nodes; // deque: nodes hold atomics and must not move
+    };
+} // namespace Utils
@@ -0,0 +1,45 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+namespace Utils
+{
+    /**
+     * @brief Read-only memory mapping of a whole file.
+     *
+     * Pages are loaded lazily by the OS on first access, so opening costs a few system calls
+     * regardless of the file size. The mapping base is page-aligned.
+     */
+    class MappedFile
+    {
+    public:
+        MappedFile() = default;
+        ~MappedFile();
+
+        MappedFile(const MappedFile &) = delete;
+        MappedFile &operator=(const MappedFile &) = delete;
+        MappedFile(MappedFile &&other) noexcept;
+        MappedFile &operator=(MappedFile &&other) noexcept;
+
+        /**
+         * @brief Maps `path`, replacing any previous mapping.
+         *
+         * @return false if the file cannot be opened or mapped, or is empty (logged).
+         */
+        bool open(const std::string &path);
+        void close();
+
+        bool isOpen() const { return m_data != nullptr; }
+        const uint8_t *data() const { return m_data; }
+        size_t size() const { return m_size; }
+
+    private:
+        const uint8_t *m_data = nullptr;
+        size_t m_size = 0;
+#ifdef _WIN32
+        void *m_file = nullptr;    // HANDLE
+        void *m_mapping = nullptr; // HANDLE
+#endif
+    };
+} // namespace Utils
@@ -0,0 +1,96 @@
+#pragma once
+#include <atomic>
+#include <cstddef>
+#include <memory>
+#include <utility>
+
+namespace Utils
+{
+    /**
+     * @brief Bounded lock-free queue for many producer threads and one consumer thread.
+     *
+     * Every cell carries a sequence number that says whose turn it is: producers claim a cell by
+     * advancing the shared tail with a compare-and-swap, fill it, then publish it by bumping its
+     * sequence; the consumer takes cells in order once they are published. Neither side ever
+     * blocks, and a full queue is reported to the producer instead of growing.
+     */
+    template <typename T>
+    class MpscQueue
+    {
+    public:
+        /**
+         * @brief Allocates `capacity` cells, rounded up to a power of two.
+         */
+        explicit MpscQueue(size_t capacity)
+        {
+            size_t cells = 2;
+            while (cells < capacity)
+                cells *= 2;
+            m_mask = cells - 1;
+            m_cells = std::make_unique<Cell[]>(cells);
+            for (size_t i = 0; i < cells; i++)
+                m_cells[i].sequence.store(i, std::memory_order_relaxed);
+        }
+
+        MpscQueue(const MpscQueue &) = delete;
+        MpscQueue &operator=(const MpscQueue &) = delete;
+
+        /**
+         * @brief Appends `value` from any thread; returns false (leaving `value` untouched) if the queue is full.
+         */
+        bool tryPush(T &value)
+        {
+            size_t tail = m_tail.load(std::memory_order_relaxed);
+            for (;;)
+            {
+                Cell &cell = m_cells[tail & m_mask];
+                const ptrdiff_t difference = (ptrdiff_t)(cell.sequence.load(std::memory_order_acquire) - tail);
+                if (difference == 0)
+                {
+                    if (m_tail.compare_exchange_weak(tail, tail + 1, std::memory_order_relaxed))
+                    {
+                        cell.value = std::move(value);
+                        cell.sequence.store(tail + 1, std::memory_order_release);
+                        return true;
+                    }
+                }
+                else if (difference < 0)
+                {
+                    return false; // The consumer has not freed this cell yet: full
+                }
+                else
+                {
+                    tail = m_tail.load(std::memory_order_relaxed); // Another producer took it
+                }
+            }
+        }
+
+        /**
+         * @brief Takes the oldest value; consumer thread only. Returns false if nothing is published.
+         */
+        bool tryPop(T &out)
+        {
+            Cell &cell = m_cells[m_head & m_mask];
+            if (cell.sequence.load(std::memory_order_acquire) != m_head + 1)
+                return false;
+            out = std::move(cell.value);
+            cell.sequence.store(m_head + m_mask + 1, std::memory_order_release);
+            m_head++;
+            return true;
+        }
+
+        size_t capacity() const { return m_mask + 1; }
+
+    private:
+        struct Cell
+        {
+            std::atomic<size_t> sequence{0};
+            T value{};
+        };
+
+        std::unique_ptr<Cell[]> m_cells;
+        size_t m_mask = 0;
+        alignas(64) std::atomic<size_t> m_tail{0}; // Next cell a producer claims
+        alignas(64) size_t m_head = 0;             // Next cell the consumer reads
+    };
+} // namespace Utils
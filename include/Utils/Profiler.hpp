@@ -0,0 +1,98 @@
+#pragma once
+#include <SDL3/SDL.h>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+namespace Utils
+{
+#ifdef ENABLE_PROFILER
+    inline constexpr bool PROFILER_ENABLED = true;
+#else
+    inline constexpr bool PROFILER_ENABLED = false;
+#endif
+
+    // Completed zones kept per thread; older zones are overwritten
+    inline constexpr size_t PROFILER_EVENTS_PER_THREAD = 1 << 16;
+    // Frames covered by the rolling frame-time histogram
+    inline constexpr size_t PROFILER_FRAME_WINDOW = 600;
+
+    struct FrameTimeStats
+    {
+        size_t frames = 0; // Frames in the window (at most PROFILER_FRAME_WINDOW)
+        double p50 = 0.0;  // Milliseconds
+        double p99 = 0.0;
+        double max = 0.0;
+    };
+
+    /**
+     * @brief Scoped-zone profiler. Use the PROFILE_* macros below rather than calling it directly.
+     *
+     * Each thread records into its own ring buffer (single writer, no locks after the thread's
+     * first zone). Timestamps come from SDL_GetPerformanceCounter(), which needs no SDL_Init().
+     */
+    namespace Profiler
+    {
+        inline uint64_t now() { return SDL_GetPerformanceCounter(); }
+
+        /**
+         * @brief Appends a finished zone to the calling thread's ring buffer.
+         *
+         * @param name Zone name; must outlive the profiler (use string literals).
+         */
+        void recordZone(const char *name, uint64_t start, uint64_t end);
+
+        /**
+         * @brief Names the calling thread in exported traces.
+         */
+        void setThreadName(const char *name);
+
+        /**
+         * @brief Adds one frame to the rolling frame-time histogram. Call from one thread only.
+         */
+        void recordFrameTime(double seconds);
+
+        /**
+         * @brief Percentiles of the frames in the rolling window, from the histogram buckets.
+         */
+        FrameTimeStats getFrameTimeStats();
+
+        /**
+         * @brief Writes every buffered zone as Chrome `trace_event` JSON (chrome://tracing, Perfetto).
+         *
+         * Zones still being written while this runs may be torn; call it while the other threads
+         * are idle (e.g. between pipeline frames or at shutdown). Errors are logged.
+         *
+         * @return true on success.
+         */
+        bool writeChromeTrace(const std::string &path);
+    } // namespace Profiler
+
+    // RAII zone: records [construction, destruction) on the current thread
+    class ProfileZone
+    {
+    public:
+        explicit ProfileZone(const char *name) : m_name(name), m_start(Profiler::now()) {}
+        ~ProfileZone() { Profiler::recordZone(m_name, m_start, Profiler::now()); }
+
+        ProfileZone(const ProfileZone &) = delete;
+        ProfileZone &operator=(const ProfileZone &) = delete;
+
+    private:
+        const char *m_name;
+        uint64_t m_start;
+    };
+} // namespace Utils
+
+// Without ENABLE_PROFILER (make PROFILE=1) every macro expands to nothing
+#ifdef ENABLE_PROFILER
+#define PROFILE_CONCAT_INNER(a, b) a##b
+#define PROFILE_CONCAT(a, b) PROFILE_CONCAT_INNER(a, b)
+#define PROFILE_ZONE(name) Utils::ProfileZone PROFILE_CONCAT(profileZone, __LINE__)(name)
+#define PROFILE_THREAD(name) Utils::Profiler::setThreadName(name)
+#define PROFILE_FRAME(seconds) Utils::Profiler::recordFrameTime(seconds)
+#else
+#define PROFILE_ZONE(name) ((void)0)
+#define PROFILE_THREAD(name) ((void)0)
+#define PROFILE_FRAME(seconds) ((void)0)
+#endif
@@ -0,0 +1,27 @@
+#pragma once
+
+namespace Utils
+{
+    enum class SimdLevel
+    {
+        SIMD_SCALAR = 0,
+        SIMD_SSE = 1,  // SSE2, baseline on x86-64
+        SIMD_AVX2 = 2
+    };
+
+    /**
+     * @brief Returns the widest instruction set the running CPU supports (detected once, then cached).
+     */
+    SimdLevel detectSimdLevel();
+
+    const char *simdLevelName(SimdLevel level);
+
+    /**
+     * @brief Lowers a requested level to one the CPU can actually run.
+     */
+    inline SimdLevel clampToSupported(SimdLevel level)
+    {
+        const SimdLevel supported = detectSimdLevel();
+        return (int)level > (int)supported ? supported : level;
+    }
+} // namespace Utils
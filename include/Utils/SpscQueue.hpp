@@ -0,0 +1,81 @@
+#pragma once
+#include <atomic>
+#include <cstddef>
+#include <memory>
+#include <utility>
+
+namespace Utils
+{
+    /**
+     * @brief Bounded lock-free ring for exactly one producer thread and one consumer thread.
+     *
+     * Each side owns one index and only reads the other's: the producer publishes a value by
+     * advancing the tail with a release store, the consumer frees its cell by advancing the head
+     * the same way. Both keep a cached copy of the other index and only reload it when the ring
+     * looks full (or empty), so an uncontended push or pop touches no shared cache line but its
+     * own. Neither side ever blocks; a full ring is reported to the producer instead of growing.
+     */
+    template <typename T>
+    class SpscQueue
+    {
+    public:
+        /**
+         * @brief Allocates `capacity` cells, rounded up to a power of two.
+         */
+        explicit SpscQueue(size_t capacity)
+        {
+            size_t cells = 2;
+            while (cells < capacity)
+                cells *= 2;
+            m_mask = cells - 1;
+            m_cells = std::make_unique<T[]>(cells);
+        }
+
+        SpscQueue(const SpscQueue &) = delete;
+        SpscQueue &operator=(const SpscQueue &) = delete;
+
+        /**
+         * @brief Appends `value`; producer thread only. Returns false (leaving `value` untouched) if the queue is full.
+         */
+        bool tryPush(T &value)
+        {
+            const size_t tail = m_tail.load(std::memory_order_relaxed);
+            if (tail - m_cachedHead > m_mask)
+            {
+                m_cachedHead = m_head.load(std::memory_order_acquire);
+                if (tail - m_cachedHead > m_mask)
+                    return false;
+            }
+            m_cells[tail & m_mask] = std::move(value);
+            m_tail.store(tail + 1, std::memory_order_release);
+            return true;
+        }
+
+        /**
+         * @brief Takes the oldest value; consumer thread only. Returns false if nothing is published.
+         */
+        bool tryPop(T &out)
+        {
+            const size_t head = m_head.load(std::memory_order_relaxed);
+            if (head == m_cachedTail)
+            {
+                m_cachedTail = m_tail.load(std::memory_order_acquire);
+                if (head == m_cachedTail)
+                    return false;
+            }
+            out = std::move(m_cells[head & m_mask]);
+            m_head.store(head + 1, std::memory_order_release);
+            return true;
+        }
+
+        size_t capacity() const { return m_mask + 1; }
+
+    private:
+        std::unique_ptr<T[]> m_cells;
+        size_t m_mask = 0;
+        alignas(64) std::atomic<size_t> m_tail{0}; // Next cell the producer writes
+        size_t m_cachedHead = 0;                   // Producer's last view of m_head
+        alignas(64) std::atomic<size_t> m_head{0}; // Next cell the consumer reads
+        size_t m_cachedTail = 0;                   // Consumer's last view of m_tail
+    };
+} // namespace Utils
@@ -1,57 +1,515 @@
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <filesystem>
+#include <memory>
+#include <span>
+#include <string>
 #include <vector>
 
+#include "Engine/AssetStreamer.hpp"
+#include "Engine/AudioMixer.hpp"
 #include "Engine/InputManager.hpp"
 #include "Engine/WindowManager.hpp"
 #include "Engine/Renderer.hpp"
+#include "Engine/FramePipeline.hpp"
+#include "Engine/InputRecording.hpp"
 
-#include "Gameplay/Player.hpp"
+#include "Gameplay/World.hpp"
+
+#include "Utils/FpsCounter.hpp"
+#include "Utils/FrameTimer.hpp"
+#include "Utils/JobSystem.hpp"
+#include "Utils/Profiler.hpp"
 
 #include "Common/Constants.hpp"
 
+namespace
+{
+    // Command-line options; see parseOptions()
+    struct Options
+    {
+        bool headless = false;
+        std::string replayPath;
+        std::string recordPath;
+        std::string tracePath;  // Chrome trace written on exit; needs a PROFILE=1 build
+        std::string levelPath;  // Binary level file (see tools/LevelConverter.cpp); empty plays the generated test level
+        std::string dumpFramesDir; // Every presented frame is written here as frame_NNNNNN.bmp; empty writes nothing
+        Engine::RendererBackend renderer = Engine::RendererBackend::RENDERER_SDL;
+        long long ticks = -1;   // Headless tick count; -1 means the replay length (or DEFAULT_HEADLESS_TICKS)
+        int workers = -1;       // -1 picks the pool size automatically, 0 runs without a pool
+        int rollbackFrames = 0; // Headless: how far each rollback check rewinds; 0 runs no checks
+        float fpsCap = Common::FRAME_RATE_CAP; // Windowed frame-rate limit; 0 renders uncapped
+        size_t streamMemory = Engine::STREAM_DEFAULT_MEMORY_CAP; // Bytes of streamed chunks kept resident
+        std::string audioDriver; // SDL audio driver (e.g. "dummy"); empty lets SDL pick
+    };
+
+    constexpr long long DEFAULT_HEADLESS_TICKS = 60 * 60; // One simulated minute
+    constexpr long long ROLLBACK_CHECK_INTERVAL = 60;     // Ticks between headless rollback checks
+
+    /**
+     * @brief Parses `--headless`, `--replay <file>`, `--record <file>`, `--ticks <n>`, `--workers <n>`, `--trace <file>`, `--fps-cap <n>`, `--level <file>`, `--renderer sdl|cpu`, `--dump-frames <dir>`, `--rollback <n>`, `--stream-memory <MiB>` and `--audio-driver <name>`.
+     *
+     * @return false (after logging) on an unknown option or a missing value.
+     */
+    bool parseOptions(int argc, char *argv[], Options &options)
+    {
+        for (int i = 1; i < argc; i++)
+        {
+            const char *arg = argv[i];
+            const bool hasValue = i + 1 < argc;
+            if (std::strcmp(arg, "--headless") == 0)
+            {
+                options.headless = true;
+            }
+            else if (std::strcmp(arg, "--replay") == 0 && hasValue)
+            {
+                options.replayPath = argv[++i];
+            }
+            else if (std::strcmp(arg, "--record") == 0 && hasValue)
+            {
+                options.recordPath = argv[++i];
+            }
+            else if (std::strcmp(arg, "--trace") == 0 && hasValue)
+            {
+                options.tracePath = argv[++i];
+            }
+            else if (std::strcmp(arg, "--ticks") == 0 && hasValue)
+            {
+                options.ticks = std::atoll(argv[++i]);
+            }
+            else if (std::strcmp(arg, "--workers") == 0 && hasValue)
+            {
+                options.workers = std::atoi(argv[++i]);
+            }
+            else if (std::strcmp(arg, "--fps-cap") == 0 && hasValue)
+            {
+                options.fpsCap = (float)std::atof(argv[++i]);
+            }
+            else if (std::strcmp(arg, "--level") == 0 && hasValue)
+            {
+                options.levelPath = argv[++i];
+            }
+            else if (std::strcmp(arg, "--renderer") == 0 && hasValue && (std::strcmp(argv[i + 1], "sdl") == 0 || std::strcmp(argv[i + 1], "cpu") == 0))
+            {
+                options.renderer = std::strcmp(argv[++i], "cpu") == 0 ? Engine::RendererBackend::RENDERER_CPU : Engine::RendererBackend::RENDERER_SDL;
+            }
+            else if (std::strcmp(arg, "--dump-frames") == 0 && hasValue)
+            {
+                options.dumpFramesDir = argv[++i];
+            }
+            else if (std::strcmp(arg, "--rollback") == 0 && hasValue)
+            {
+                options.rollbackFrames = std::max(0, std::atoi(argv[++i]));
+            }
+            else if (std::strcmp(arg, "--stream-memory") == 0 && hasValue)
+            {
+                options.streamMemory = (size_t)std::max(0, std::atoi(argv[++i])) * 1024 * 1024;
+            }
+            else if (std::strcmp(arg, "--audio-driver") == 0 && hasValue)
+            {
+                options.audioDriver = argv[++i];
+            }
+            else
+            {
+                SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Unknown or incomplete option %s", arg);
+                SDL_Log("Usage: %s [--headless] [--replay file] [--record file] [--ticks n] [--workers n] [--trace file] [--fps-cap n] [--level file] [--renderer sdl|cpu] [--dump-frames dir] [--rollback n] [--stream-memory MiB] [--audio-driver name]", argv[0]);
+                return false;
+            }
+        }
+        return true;
+    }
+
+    /**
+     * @brief Creates the worker pool requested on the command line; nullptr means run single-threaded.
+     */
+    std::unique_ptr<Utils::JobSystem> createJobSystem(const Options &options)
+    {
+        if (options.workers == 0)
+            return nullptr;
+        return std::make_unique<Utils::JobSystem>(options.workers < 0 ? 0u : (unsigned)options.workers);
+    }
+
+    /**
+     * @brief Path of the `index`-th frame written with `--dump-frames`.
+     */
+    std::string frameDumpPath(const std::string &directory, uint64_t index)
+    {
+        char name[32];
+        std::snprintf(name, sizeof(name), "frame_%06llu.bmp", (unsigned long long)index);
+        return (std::filesystem::path(directory) / name).string();
+    }
+
+    /**
+     * @brief Maps the level given with `--level`, logging how long it took; succeeds trivially without one.
+     */
+    bool openLevel(const Options &options, Gameplay::Level &level)
+    {
+        if (options.levelPath.empty())
+            return true;
+
+        const uint64_t start = Utils::FrameClock::nowNs();
+        if (!level.open(options.levelPath))
+            return false;
+        SDL_Log("Level %s: %d x %d chunks, %zu spawns, opened in %.2f ms", options.levelPath.c_str(), level.getWidthInChunks(),
+                level.getHeightInChunks(), level.getSpawns().size(), (double)(Utils::FrameClock::nowNs() - start) / 1e6);
+        return true;
+    }
+
+    /**
+     * @brief Logs the frame-time percentiles and writes the Chrome trace requested with `--trace`.
+     *
+     * Does nothing in builds without the profiler (other than warning that `--trace` was ignored).
+     *
+     * @return false if the trace could not be written.
+     */
+    bool reportProfile(const Options &options)
+    {
+        if constexpr (!Utils::PROFILER_ENABLED)
+        {
+            if (!options.tracePath.empty())
+                SDL_LogWarn(SDL_LOG_CATEGORY_APPLICATION, "--trace ignored: built without PROFILE=1");
+            return true;
+        }
+
+        const Utils::FrameTimeStats stats = Utils::Profiler::getFrameTimeStats();
+        if (stats.frames > 0)
+        {
+            SDL_Log("Frame time over the last %zu frames: p50 %.1f ms, p99 %.1f ms, max %.2f ms",
+                    stats.frames, stats.p50, stats.p99, stats.max);
+        }
+        return options.tracePath.empty() || Utils::Profiler::writeChromeTrace(options.tracePath);
+    }
+
+    Common::InputState replayInput(const Engine::InputRecording &replay, long long tick)
+    {
+        return (size_t)tick < replay.size() ? replay.at((size_t)tick) : Common::InputState{};
+    }
+
+    /**
+     * @brief Headless `--rollback <n>` check of the world snapshots.
+     *
+     * Saves a snapshot after every step into a history of n + 1 frames. Every ROLLBACK_CHECK_INTERVAL
+     * ticks it rolls the world back n steps and re-simulates them from the replay, as rollback
+     * netcode would on a late input; the state hash must come out the same, and right after the
+     * restore the spatial hash must describe the restored entities.
+     */
+    class RollbackChecker
+    {
+    public:
+        explicit RollbackChecker(int frames) : m_frames(frames), m_history((size_t)frames + 1) {}
+
+        /**
+         * @brief Runs after the step of `tick`; may step the world again to re-simulate.
+         */
+        void afterStep(Gameplay::World &world, const Engine::InputRecording &replay, long long tick)
+        {
+            save(world);
+            if ((tick + 1) % ROLLBACK_CHECK_INTERVAL != 0 || m_history.size() <= (size_t)m_frames)
+                return;
+
+            const uint64_t expected = world.computeStateHash();
+            const uint64_t start = Utils::FrameClock::nowNs();
+            const bool restored = m_history.rollBack((size_t)m_frames) && world.restoreSnapshot(m_history.newest());
+            m_restoreNs += Utils::FrameClock::nowNs() - start;
+            m_restores++;
+            if (restored && !spatialHashMatches(world))
+            {
+                m_failures++;
+                SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Spatial hash is stale after the rollback at tick %lld", tick);
+            }
+
+            for (long long resimulated = tick - m_frames + 1; resimulated <= tick; resimulated++)
+            {
+                world.step(replayInput(replay, resimulated));
+                save(world);
+            }
+            m_checks++;
+            if (!restored || world.computeStateHash() != expected)
+            {
+                m_failures++;
+                SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Rollback of %d steps at tick %lld diverged", m_frames, tick);
+            }
+        }
+
+        void report() const
+        {
+            SDL_Log("Rollback: %lld checks of %d steps, %lld diverged; save %.1f us, restore %.1f us on average, %.2f MB of deltas held",
+                    m_checks, m_frames, m_failures, m_saves > 0 ? (double)m_saveNs / m_saves / 1e3 : 0.0,
+                    m_restores > 0 ? (double)m_restoreNs / m_restores / 1e3 : 0.0, (double)m_history.getDeltaBytes() / (1024.0 * 1024.0));
+        }
+
+        bool passed() const { return m_failures == 0; }
+
+    private:
+        /**
+         * @brief Whether the hash holds exactly the world's entities: each one's own box finds its dense index, and no index is out of range.
+         */
+        bool spatialHashMatches(const Gameplay::World &world)
+        {
+            const Gameplay::EntityStore &entities = world.getEntities();
+            const Gameplay::SpatialHash &hash = world.getSpatialHash();
+            if (hash.size() != entities.size())
+                return false;
+            for (size_t i = 0; i < entities.size(); i++)
+            {
+                const Gameplay::AABB box = {entities.posX[i], entities.posY[i], entities.width[i], entities.height[i]};
+                size_t found = hash.queryAABB(box, m_found.data(), m_found.size());
+                if (found > m_found.size())
+                {
+                    m_found.resize(found);
+                    found = hash.queryAABB(box, m_found.data(), m_found.size());
+                }
+                bool self = false;
+                for (size_t k = 0; k < found; k++)
+                {
+                    if (m_found[k] >= entities.size())
+                        return false;
+                    self = self || m_found[k] == i;
+                }
+                if (!self)
+                    return false;
+            }
+            return true;
+        }
+
+        void save(const Gameplay::World &world)
+        {
+            const uint64_t start = Utils::FrameClock::nowNs();
+            world.saveSnapshot(m_snapshot);
+            m_history.push(m_snapshot);
+            m_saveNs += Utils::FrameClock::nowNs() - start;
+            m_saves++;
+        }
+
+        int m_frames;
+        Gameplay::SnapshotHistory m_history;
+        Gameplay::WorldSnapshot m_snapshot;
+        std::vector<uint32_t> m_found; // Query buffer of spatialHashMatches()
+        long long m_checks = 0, m_failures = 0, m_saves = 0, m_restores = 0;
+        uint64_t m_saveNs = 0, m_restoreNs = 0;
+    };
+
+    /**
+     * @brief Steps the simulation as fast as possible with no window, renderer or SDL subsystem.
+     *
+     * Inputs come from the replay file when one is given (ticks past its end see no input), otherwise
+     * every step sees no input. Prints the tick rate achieved and the final state hash, which must
+     * match between runs of the same replay, with or without `--rollback`.
+     *
+     * @return Process exit code.
+     */
+    int runHeadless(const Options &options)
+    {
+        Engine::InputRecording replay;
+        if (!options.replayPath.empty() && !replay.load(options.replayPath))
+            return 1;
+
+        const long long ticks = options.ticks >= 0 ? options.ticks : (options.replayPath.empty() ? DEFAULT_HEADLESS_TICKS : (long long)replay.size());
+
+        Gameplay::Level level;
+        if (!openLevel(options, level))
+            return 1;
+
+        std::unique_ptr<Utils::JobSystem> jobs = createJobSystem(options);
+        Gameplay::World world = options.levelPath.empty() ? Gameplay::World() : Gameplay::World(level);
+        world.setJobSystem(jobs.get());
+
+        std::unique_ptr<RollbackChecker> rollback = options.rollbackFrames > 0 ? std::make_unique<RollbackChecker>(options.rollbackFrames) : nullptr;
+
+        PROFILE_THREAD("Main");
+        const auto start = std::chrono::steady_clock::now();
+        for (long long tick = 0; tick < ticks; tick++)
+        {
+#ifdef ENABLE_PROFILER
+            const uint64_t tickStart = Utils::FrameClock::nowNs();
+#endif
+            world.step(replayInput(replay, tick));
+            if (rollback)
+                rollback->afterStep(world, replay, tick);
+            PROFILE_FRAME((double)(Utils::FrameClock::nowNs() - tickStart) / Utils::NS_PER_SECOND);
+        }
+        const double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+        SDL_Log("Headless: %lld ticks in %.3f s (%.0f ticks/s, %.1fx real time), %zu entities, state hash %016llx",
+                ticks, seconds, seconds > 0.0 ? ticks / seconds : 0.0, seconds > 0.0 ? ticks * Common::TIME_STEP / seconds : 0.0,
+                world.getEntities().size(), (unsigned long long)world.computeStateHash());
+        if (rollback)
+            rollback->report();
+        const bool profiled = reportProfile(options);
+        return profiled && (!rollback || rollback->passed()) ? 0 : 1;
+    }
+}
+
 /**
  * @brief Application entry point that initializes engine subsystems and runs the main game loop.
  *
- * Initializes the window, input manager, renderer, and player; then enters a loop that
- * performs time-stepping, input polling (including quit handling), game update, and
- * frame command collection/rendering until the application exits.
+ * Initializes the window, input manager, renderer, and game world; then enters a loop that
+ * polls input (including quit handling) and renders as fast as the display allows until the
+ * application exits. The simulation runs one frame ahead on its own thread: it advances in fixed
+ * `Common::TIME_STEP` increments using a time accumulator and emits render commands with entities
+ * interpolated by the leftover fraction of a step, while the main thread draws the previous frame.
+ *
+ * With `--headless` no window is created and the simulation runs flat out instead (see runHeadless());
+ * `--rollback <n>` adds periodic snapshot rollback and re-simulation checks to it. `--record <file>` saves
+ * the per-step input of a windowed session for replay, and `--trace <file>` writes the profiler's zones on
+ * exit in builds made with `PROFILE=1`. `--fps-cap <n>` limits the windowed frame rate, and `--level <file>`
+ * plays a binary level instead of the generated one. `--renderer cpu` draws with the CPU rasterizer instead
+ * of SDL_Renderer, and `--dump-frames <dir>` writes every frame to disk as a BMP for golden-image
+ * comparisons. Sprites and the level chunks around the player stream in on background threads;
+ * `--stream-memory <MiB>` caps how much decoded chunk data stays resident. Each frame's sound events are
+ * played through the audio mixer; `--audio-driver <name>` picks SDL's audio driver (`dummy` mixes without a
+ * sound card), and without a usable device the game runs silent.
  *
  * @return int Exit code; `0` indicates successful termination.
  */
 int main(int argc, char *argv[])
 {
-    // Suppress unused parameter warnings
-    (void)argc;
-    (void)argv;
+    Options options;
+    if (!parseOptions(argc, argv, options))
+        return 1;
+    if (options.headless)
+        return runHeadless(options);
+
+    Gameplay::Level level;
+    if (!openLevel(options, level))
+        return 1;
 
     Engine::WindowManager window(Common::WINDOW_TITLE_PREFIX, Common::MINIMUM_SCREEN_WIDTH, Common::MINIMUM_SCREEN_HEIGHT);
     Engine::InputManager inputSystem;
-    Engine::Renderer renderer(window.getSDLWindow());
 
-    Gameplay::Player player;
+    // Declared before the renderer and the world so it outlives both
+    std::unique_ptr<Utils::JobSystem> jobs = createJobSystem(options);
+
+    std::unique_ptr<Engine::Renderer> renderer = Engine::Renderer::create(options.renderer, window.getSDLWindow(), jobs.get());
+
+    Gameplay::World world = options.levelPath.empty() ? Gameplay::World() : Gameplay::World(level);
+    world.setJobSystem(jobs.get());
+
+    // Declared after the world, so its I/O threads stop before the level they read goes away
+    Engine::AssetStreamer streamer(Engine::STREAM_THREAD_COUNT, options.streamMemory);
+
+    // Sprites stream in over the first frames; until one arrives (or if it is missing from disk) it keeps its fallback color
+    const char *basePath = SDL_GetBasePath();
+    const std::string assetRoot = basePath ? basePath : "";
+    for (int id = 0; id < (int)Common::TextureID::TEX_COUNT; id++)
+    {
+        streamer.requestTexture((Common::TextureID)id, assetRoot + Common::TEXTURE_PATHS[id]);
+    }
+
+    // Static tiles are decoded from the level's tiles on the stream threads ahead of the player, or on the main
+    // thread when a chunk is drawn before it arrived. Nothing calls setTile() while the pipeline runs; an edit
+    // would bump the chunk version the simulation thread sends and need streamer.invalidateChunks()
+    streamer.setChunkSource([&world](int chunkX, int chunkY, Utils::FrameVector<Common::RenderCommand> &out)
+                            { world.getLevel().collectChunkLocalCommands({chunkX, chunkY}, out); },
+                            world.getLevel().getWidthInChunks(), world.getLevel().getHeightInChunks());
+    renderer->setStaticChunkSource([&world, &streamer](int chunkX, int chunkY, Utils::FrameVector<Common::RenderCommand> &out)
+                                   {
+        if (!streamer.copyChunk(chunkX, chunkY, out))
+            world.getLevel().collectChunkLocalCommands({chunkX, chunkY}, out); });
+
+    // Declared after the window, so the device is closed before the window shuts SDL down. Sounds are
+    // small, so they are loaded up front; a missing file becomes a generated fallback tone
+    if (!options.audioDriver.empty())
+        SDL_SetHint(SDL_HINT_AUDIO_DRIVER, options.audioDriver.c_str());
+    Engine::AudioMixer audio;
+    for (int id = 0; id < (int)Common::SoundID::SOUND_COUNT; id++)
+    {
+        audio.loadSound((Common::SoundID)id, assetRoot + Common::SOUND_PATHS[id]);
+    }
+    audio.open();
+
+    // Per-step input for --record; owned by the simulation thread while the pipeline runs
+    Engine::InputRecording recording;
+    const bool recordInput = !options.recordPath.empty();
+
+    // Real time not yet consumed by fixed simulation steps; owned by the simulation thread
+    float accumulator = 0.0f;
+    // Turns the frame's timestamped events into per-step input; owned by the simulation thread
+    Engine::InputTickBuilder tickInput;
+
+    // Runs on the simulation thread: fixed steps for the frame, then the frame's render commands
+    Engine::FramePipeline pipeline([&](const Engine::FrameInput &frame, Engine::FramePacket &packet)
+                                   {
+        tickInput.push(frame.events);
+        accumulator += frame.frameTime;
+
+        int steps = 0;
+        while (accumulator >= Common::TIME_STEP && steps < Common::MAX_STEPS_PER_FRAME)
+        {
+            // Steps lag real time by what stays in the accumulator, so this step ends that long before the frame
+            const double lagNs = (double)(accumulator - Common::TIME_STEP) * Utils::NS_PER_SECOND;
+            const Common::InputState input = tickInput.buildTick(frame.timestamp - (uint64_t)lagNs);
+            if (recordInput)
+                recording.append(input);
+            world.step(input);
+            const std::span<const Common::SoundEvent> sounds = world.getSoundEvents();
+            packet.sounds.insert(packet.sounds.end(), sounds.begin(), sounds.end());
+            accumulator -= Common::TIME_STEP;
+            steps++;
+        }
+        // Still behind after the step cap: drop the backlog instead of catching up
+        if (steps == Common::MAX_STEPS_PER_FRAME && accumulator >= Common::TIME_STEP)
+        {
+            accumulator = 0.0f;
+        }
 
-    // For updating the fps counter via fpsCounter()
-    Uint64 fps = 0;
-    Uint64 lastFpsTime = 0;
-    Uint64 lastTime = SDL_GetTicks();
+        const float alpha = accumulator / Common::TIME_STEP;
 
+        packet.simulationSteps = steps;
+        packet.focus = world.getStreamFocus();
+        world.collectRenderCommands(alpha, packet.commands, packet.staticChunks);
+        world.collectParticles(alpha, packet.particles); });
+
+    // Frame timing: nanosecond deltas, rolling stats for the window title and the optional cap
+    Utils::FrameClock clock;
+    Utils::FpsCounter fpsCounter;
+    Utils::FrameLimiter limiter(options.fpsCap);
+    float sinceTitleRefresh = 0.0f;
+
+    // Prime the pipeline so there is always a finished frame to draw
+    pipeline.kick({});
+
+    // Reused every frame so handing events to the simulation does not allocate in steady state
+    Engine::FrameInput frameInput;
+    uint64_t dumpedFrames = 0;
+
+    PROFILE_THREAD("Main");
     bool running = true;
     while (running)
     {
-        std::vector<Common::RenderCommand> frameCommands;
-        frameCommands.reserve(16);
+        limiter.wait();
 
-        Uint64 currentTime = SDL_GetTicks();
-        float deltaTime = (currentTime - lastTime) / 1000.0f;
-        lastTime = currentTime;
+        const uint64_t frameNs = clock.tick();
+        float frameTime = (float)((double)frameNs / Utils::NS_PER_SECOND);
+
+        fpsCounter.addFrame(frameNs);
+        sinceTitleRefresh += frameTime;
+        if (sinceTitleRefresh >= Common::FPS_TITLE_REFRESH_TIME)
+        {
+            window.showFrameStats(fpsCounter.getStats());
+            sinceTitleRefresh = 0.0f;
+        }
 
-        window.fpsCounter(currentTime, lastFpsTime, fps);
+        PROFILE_FRAME(frameTime);
 
-        if (deltaTime > 0.1f)
+        // Avoid the spiral of death after a stall (breakpoint, window drag, ...)
+        if (frameTime > Common::MAX_FRAME_TIME)
         {
-            deltaTime = 0.1f;
+            frameTime = Common::MAX_FRAME_TIME;
         }
 
-        Common::InputState currentInput = inputSystem.update();
+        Common::InputState currentInput;
+        frameInput.events.clear();
+        {
+            PROFILE_ZONE("input");
+            currentInput = inputSystem.update();
+            inputSystem.drainEvents(frameInput.events);
+        }
+        frameInput.timestamp = SDL_GetTicksNS();
+        frameInput.frameTime = frameTime;
 
         if (currentInput.quit)
         {
@@ -59,17 +517,60 @@ int main(int argc, char *argv[])
         }
         window.update(currentInput);
 
-        player.update(deltaTime, currentInput);
+        // Frame N is complete; simulate frame N+1 while frame N is drawn and presented
+        const Engine::FramePacket *frame;
+        {
+            PROFILE_ZONE("waitForFrame");
+            frame = &pipeline.waitForFrame();
+        }
+        pipeline.kick(frameInput);
+
+        // Only queues commands for the audio thread, so it never waits on it
+        for (const Common::SoundEvent &sound : frame->sounds)
+        {
+            audio.play(sound.sound, 1.0f, sound.pan);
+        }
 
-        renderer.beginFrame();
+        // Before drawing, so chunks that arrived this frame are used by it
+        streamer.update(frame->focus, *renderer);
 
-        frameCommands.clear();
-        frameCommands.push_back(player.getRenderCommand());
+        {
+            PROFILE_ZONE("beginFrame");
+            renderer->beginFrame();
+        }
+        {
+            PROFILE_ZONE("drawStaticChunks");
+            renderer->drawStaticChunks(frame->staticChunks);
+        }
+        {
+            PROFILE_ZONE("drawCommands");
+            renderer->drawCommands(frame->commands);
+        }
+        {
+            PROFILE_ZONE("drawParticles");
+            renderer->drawParticles(frame->particles);
+        }
+        {
+            PROFILE_ZONE("endFrame");
+            if (!options.dumpFramesDir.empty())
+                renderer->captureNextFrame(frameDumpPath(options.dumpFramesDir, dumpedFrames++));
+            renderer->endFrame();
+        }
+    }
 
-        renderer.drawCommands(frameCommands);
+    // Collect the frame still in flight so the simulation thread is done with the recording
+    pipeline.waitForFrame();
+    if (recordInput && !recording.save(options.recordPath))
+        return 1;
 
-        renderer.endFrame();
+    if (inputSystem.getDroppedEvents() > 0)
+        SDL_LogWarn(SDL_LOG_CATEGORY_INPUT, "Input: %zu events dropped to a full buffer", inputSystem.getDroppedEvents());
+    if (audio.isOpen())
+    {
+        const Engine::AudioStats stats = audio.getStats();
+        SDL_Log("Audio: %.1f s mixed, peak %d voices, %llu stolen, %llu commands dropped", (double)stats.framesMixed / Engine::AUDIO_SAMPLE_RATE,
+                stats.peakVoices, (unsigned long long)stats.voicesStolen, (unsigned long long)stats.commandsDropped);
     }
 
-    return 0;
+    return reportProfile(options) ? 0 : 1;
 }
\ No newline at end of file
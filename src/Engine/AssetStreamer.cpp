@@ -0,0 +1,307 @@
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <utility>
+
+#include "Common/Constants.hpp"
+#include "Engine/AssetStreamer.hpp"
+#include "Utils/FrameTimer.hpp"
+#include "Utils/Profiler.hpp"
+
+namespace Engine
+{
+    AssetStreamer::AssetStreamer(unsigned threadCount, size_t memoryCap)
+        : m_memoryCap(memoryCap)
+    {
+        threadCount = std::max(threadCount, 1u);
+        m_threads.reserve(threadCount);
+        for (unsigned i = 0; i < threadCount; i++)
+            m_threads.emplace_back(&AssetStreamer::workerLoop, this);
+    }
+
+    AssetStreamer::~AssetStreamer()
+    {
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            m_running.store(false, std::memory_order_release);
+        }
+        m_wake.notify_all();
+        for (std::thread &thread : m_threads)
+            thread.join();
+
+        Completion done;
+        while (m_completions.tryPop(done))
+        {
+            if (done.surface)
+                SDL_DestroySurface(done.surface);
+        }
+    }
+
+    void AssetStreamer::requestTexture(Common::TextureID id, std::string path)
+    {
+        Request request;
+        request.kind = RequestKind::REQUEST_TEXTURE;
+        request.texture = id;
+        request.path = std::move(path);
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            m_pending.push_back(std::move(request));
+        }
+        m_wake.notify_one();
+    }
+
+    void AssetStreamer::setChunkSource(StaticChunkSource source, int widthInChunks, int heightInChunks)
+    {
+        m_chunkSource = std::move(source);
+        m_widthInChunks = widthInChunks;
+        m_heightInChunks = heightInChunks;
+    }
+
+    /**
+     * @brief Waits for a request, loads it without holding the lock, and posts the result.
+     *
+     * A full completion queue means the main thread is behind; the result is held and retried
+     * rather than dropped, which also stops this thread from loading further ahead.
+     */
+    void AssetStreamer::workerLoop()
+    {
+        PROFILE_THREAD("Stream");
+        for (;;)
+        {
+            Request request;
+            {
+                std::unique_lock<std::mutex> lock(m_mutex);
+                m_wake.wait(lock, [this] { return !m_running.load(std::memory_order_relaxed) || !m_pending.empty(); });
+                if (!m_running.load(std::memory_order_relaxed))
+                    return;
+                request = takeMostUrgent();
+            }
+
+            Completion done;
+            done.kind = request.kind;
+            done.generation = request.generation;
+            if (request.kind == RequestKind::REQUEST_TEXTURE)
+            {
+                PROFILE_ZONE("streamTexture");
+                done.texture = request.texture;
+                done.surface = SDL_LoadBMP(request.path.c_str());
+                if (!done.surface)
+                    SDL_LogError(1, "Failed to load texture %s: %s", request.path.c_str(), SDL_GetError());
+            }
+            else
+            {
+                PROFILE_ZONE("streamChunk");
+                done.chunkX = request.chunkX;
+                done.chunkY = request.chunkY;
+                m_chunkSource(request.chunkX, request.chunkY, done.commands);
+            }
+
+            while (!m_completions.tryPush(done))
+            {
+                if (!m_running.load(std::memory_order_acquire))
+                {
+                    if (done.surface)
+                        SDL_DestroySurface(done.surface);
+                    return;
+                }
+                std::this_thread::yield();
+            }
+        }
+    }
+
+    /**
+     * @brief Linear scan with the current focus: textures first, then the chunk with the lowest score.
+     *
+     * The score is the distance from the focus to the chunk's center minus STREAM_DIRECTION_WEIGHT
+     * times how far the center lies along the direction of travel. At most a few dozen requests are
+     * pending, so scanning beats keeping a heap up to date as the focus moves.
+     */
+    AssetStreamer::Request AssetStreamer::takeMostUrgent()
+    {
+        const Common::StreamFocus &focus = m_focus;
+        const float speed = std::sqrt(focus.velX * focus.velX + focus.velY * focus.velY);
+        const float dirX = speed > 0.0f ? focus.velX / speed : 0.0f;
+        const float dirY = speed > 0.0f ? focus.velY / speed : 0.0f;
+
+        size_t best = 0;
+        float bestScore = std::numeric_limits<float>::max();
+        for (size_t i = 0; i < m_pending.size(); i++)
+        {
+            const Request &request = m_pending[i];
+            if (request.kind == RequestKind::REQUEST_TEXTURE)
+            {
+                best = i;
+                break;
+            }
+            const float dx = ((float)request.chunkX + 0.5f) * Common::CHUNK_PIXELS - focus.x;
+            const float dy = ((float)request.chunkY + 0.5f) * Common::CHUNK_PIXELS - focus.y;
+            const float score = std::sqrt(dx * dx + dy * dy) - STREAM_DIRECTION_WEIGHT * (dx * dirX + dy * dirY);
+            if (score < bestScore)
+            {
+                bestScore = score;
+                best = i;
+            }
+        }
+
+        Request request = std::move(m_pending[best]);
+        m_pending[best] = std::move(m_pending.back());
+        m_pending.pop_back();
+        return request;
+    }
+
+    /**
+     * @brief Wanted area: the square of STREAM_RADIUS_CHUNKS around the chunk the player will be in
+     * STREAM_LOOKAHEAD_SECONDS from now, clamped to the level.
+     */
+    void AssetStreamer::requestAround(const Common::StreamFocus &focus)
+    {
+        if (!m_chunkSource || m_widthInChunks <= 0 || m_heightInChunks <= 0)
+            return;
+
+        const float aheadX = focus.x + focus.velX * STREAM_LOOKAHEAD_SECONDS;
+        const float aheadY = focus.y + focus.velY * STREAM_LOOKAHEAD_SECONDS;
+        const int centerX = std::clamp((int)std::floor(aheadX / Common::CHUNK_PIXELS), 0, m_widthInChunks - 1);
+        const int centerY = std::clamp((int)std::floor(aheadY / Common::CHUNK_PIXELS), 0, m_heightInChunks - 1);
+        const int minX = std::max(centerX - STREAM_RADIUS_CHUNKS, 0);
+        const int maxX = std::min(centerX + STREAM_RADIUS_CHUNKS, m_widthInChunks - 1);
+        const int minY = std::max(centerY - STREAM_RADIUS_CHUNKS, 0);
+        const int maxY = std::min(centerY + STREAM_RADIUS_CHUNKS, m_heightInChunks - 1);
+        auto wanted = [&](int chunkX, int chunkY)
+        { return chunkX >= minX && chunkX <= maxX && chunkY >= minY && chunkY <= maxY; };
+
+        size_t added = 0;
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            m_focus = focus;
+
+            auto left = std::partition(m_pending.begin(), m_pending.end(), [&](const Request &request)
+                                       { return request.kind == RequestKind::REQUEST_TEXTURE || wanted(request.chunkX, request.chunkY); });
+            for (auto it = left; it != m_pending.end(); ++it)
+                m_requested.erase(chunkKey(it->chunkX, it->chunkY));
+            m_stats.chunksCancelled += (uint64_t)(m_pending.end() - left);
+            m_pending.erase(left, m_pending.end());
+
+            for (int chunkY = minY; chunkY <= maxY; chunkY++)
+            {
+                for (int chunkX = minX; chunkX <= maxX; chunkX++)
+                {
+                    const uint64_t key = chunkKey(chunkX, chunkY);
+                    auto resident = m_resident.find(key);
+                    if (resident != m_resident.end())
+                    {
+                        resident->second.lastUsedFrame = m_frame; // Wanted chunks are not evicted, drawn or not
+                        continue;
+                    }
+                    if (!m_requested.insert(key).second)
+                        continue;
+
+                    Request request;
+                    request.chunkX = chunkX;
+                    request.chunkY = chunkY;
+                    request.generation = m_generation;
+                    m_pending.push_back(std::move(request));
+                    added++;
+                }
+            }
+        }
+        if (added == 1)
+            m_wake.notify_one();
+        else if (added > 1)
+            m_wake.notify_all();
+    }
+
+    int AssetStreamer::update(const Common::StreamFocus &focus, Renderer &renderer, uint64_t budgetNs)
+    {
+        PROFILE_ZONE("AssetStreamer::update");
+        m_frame++;
+        requestAround(focus);
+
+        const uint64_t start = Utils::FrameClock::nowNs();
+        int handled = 0;
+        bool texturesAdded = false;
+        Completion done;
+        while (m_completions.tryPop(done))
+        {
+            handled++;
+            if (done.kind == RequestKind::REQUEST_TEXTURE)
+            {
+                if (done.surface)
+                {
+                    texturesAdded |= renderer.addTexture(done.texture, done.surface);
+                    SDL_DestroySurface(done.surface);
+                    done.surface = nullptr;
+                    m_stats.texturesLoaded++;
+                }
+            }
+            else if (done.generation == m_generation)
+            {
+                const uint64_t key = chunkKey(done.chunkX, done.chunkY);
+                m_requested.erase(key);
+                ResidentChunk &chunk = m_resident[key];
+                chunk.commands = std::move(done.commands);
+                chunk.bytes = sizeof(ResidentChunk) + chunk.commands.capacity() * sizeof(Common::RenderCommand);
+                chunk.lastUsedFrame = m_frame;
+                m_stats.residentBytes += chunk.bytes;
+                m_stats.chunksLoaded++;
+            }
+            done.commands.clear();
+
+            if (Utils::FrameClock::nowNs() - start >= budgetNs)
+                break;
+        }
+
+        if (texturesAdded)
+            renderer.buildAtlas();
+        evictOverCap();
+        m_stats.residentChunks = m_resident.size();
+        m_stats.peakResidentBytes = std::max(m_stats.peakResidentBytes, m_stats.residentBytes);
+        return handled;
+    }
+
+    bool AssetStreamer::copyChunk(int chunkX, int chunkY, Utils::FrameVector<Common::RenderCommand> &out)
+    {
+        auto it = m_resident.find(chunkKey(chunkX, chunkY));
+        if (it == m_resident.end())
+            return false;
+        it->second.lastUsedFrame = m_frame;
+        out.insert(out.end(), it->second.commands.begin(), it->second.commands.end());
+        return true;
+    }
+
+    void AssetStreamer::invalidateChunks()
+    {
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            std::erase_if(m_pending, [](const Request &request) { return request.kind == RequestKind::REQUEST_CHUNK; });
+        }
+        m_requested.clear();
+        m_resident.clear();
+        m_generation++;
+        m_stats.residentBytes = 0;
+        m_stats.residentChunks = 0;
+    }
+
+    /**
+     * @brief Evicts least recently used chunks until under the cap; chunks used this frame always stay.
+     *
+     * A linear scan per eviction: the cache holds tens of chunks, and evictions only happen as the
+     * player crosses into new areas.
+     */
+    void AssetStreamer::evictOverCap()
+    {
+        while (m_stats.residentBytes > m_memoryCap)
+        {
+            auto oldest = m_resident.end();
+            for (auto it = m_resident.begin(); it != m_resident.end(); ++it)
+            {
+                if (it->second.lastUsedFrame < m_frame && (oldest == m_resident.end() || it->second.lastUsedFrame < oldest->second.lastUsedFrame))
+                    oldest = it;
+            }
+            if (oldest == m_resident.end())
+                return;
+            m_stats.residentBytes -= oldest->second.bytes;
+            m_resident.erase(oldest);
+            m_stats.chunksEvicted++;
+        }
+    }
+} // namespace Engine
@@ -0,0 +1,513 @@
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <string>
+
+#include "Engine/AudioMixer.hpp"
+
+#if defined(__x86_64__) || defined(__i386__)
+#define AUDIO_MIXER_X86 1
+#include <immintrin.h>
+#endif
+
+namespace
+{
+    // Pitch and length of the tone synthesized for a sound whose file is missing, indexed by Common::SoundID
+    struct FallbackTone
+    {
+        float frequency;
+        float seconds;
+    };
+    constexpr FallbackTone FALLBACK_TONES[] = {
+        {880.0f, 0.08f}, // SOUND_SHOOT
+        {220.0f, 0.15f}, // SOUND_HIT
+        {110.0f, 0.10f}, // SOUND_LAND
+    };
+    static_assert(sizeof(FALLBACK_TONES) / sizeof(FALLBACK_TONES[0]) == (int)Common::SoundID::SOUND_COUNT);
+
+    constexpr float HALF_PI = 1.5707963f;
+    constexpr float TWO_PI = 4.0f * HALF_PI;
+
+    void mixMonoScalar(float *left, float *right, const float *samples, size_t begin, size_t count,
+                       float gainLeft, float gainRight, float stepLeft, float stepRight)
+    {
+        for (size_t i = begin; i < count; i++)
+        {
+            const float t = (float)i;
+            left[i] += samples[i] * (gainLeft + stepLeft * t);
+            right[i] += samples[i] * (gainRight + stepRight * t);
+        }
+    }
+
+    void interleaveScalar(float *out, const float *left, const float *right, size_t begin, size_t count, float volume)
+    {
+        for (size_t i = begin; i < count; i++)
+        {
+            out[2 * i] = std::clamp(left[i] * volume, -1.0f, 1.0f);
+            out[2 * i + 1] = std::clamp(right[i] * volume, -1.0f, 1.0f);
+        }
+    }
+
+#ifdef AUDIO_MIXER_X86
+    size_t mixMonoSse(float *left, float *right, const float *samples, size_t count,
+                      float gainLeft, float gainRight, float stepLeft, float stepRight)
+    {
+        const __m128 lane = _mm_set_ps(3.0f, 2.0f, 1.0f, 0.0f);
+        __m128 gainL = _mm_add_ps(_mm_set1_ps(gainLeft), _mm_mul_ps(_mm_set1_ps(stepLeft), lane));
+        __m128 gainR = _mm_add_ps(_mm_set1_ps(gainRight), _mm_mul_ps(_mm_set1_ps(stepRight), lane));
+        const __m128 advanceL = _mm_set1_ps(stepLeft * 4.0f);
+        const __m128 advanceR = _mm_set1_ps(stepRight * 4.0f);
+
+        size_t i = 0;
+        for (; i + 4 <= count; i += 4)
+        {
+            const __m128 s = _mm_loadu_ps(samples + i);
+            _mm_storeu_ps(left + i, _mm_add_ps(_mm_loadu_ps(left + i), _mm_mul_ps(s, gainL)));
+            _mm_storeu_ps(right + i, _mm_add_ps(_mm_loadu_ps(right + i), _mm_mul_ps(s, gainR)));
+            gainL = _mm_add_ps(gainL, advanceL);
+            gainR = _mm_add_ps(gainR, advanceR);
+        }
+        return i;
+    }
+
+    size_t interleaveSse(float *out, const float *left, const float *right, size_t count, float volume)
+    {
+        const __m128 scale = _mm_set1_ps(volume);
+        const __m128 low = _mm_set1_ps(-1.0f), high = _mm_set1_ps(1.0f);
+
+        size_t i = 0;
+        for (; i + 4 <= count; i += 4)
+        {
+            const __m128 l = _mm_min_ps(_mm_max_ps(_mm_mul_ps(_mm_loadu_ps(left + i), scale), low), high);
+            const __m128 r = _mm_min_ps(_mm_max_ps(_mm_mul_ps(_mm_loadu_ps(right + i), scale), low), high);
+            _mm_storeu_ps(out + 2 * i, _mm_unpacklo_ps(l, r));
+            _mm_storeu_ps(out + 2 * i + 4, _mm_unpackhi_ps(l, r));
+        }
+        return i;
+    }
+
+    __attribute__((target("avx2"))) size_t mixMonoAvx2(float *left, float *right, const float *samples, size_t count,
+                                                       float gainLeft, float gainRight, float stepLeft, float stepRight)
+    {
+        const __m256 lane = _mm256_set_ps(7.0f, 6.0f, 5.0f, 4.0f, 3.0f, 2.0f, 1.0f, 0.0f);
+        __m256 gainL = _mm256_add_ps(_mm256_set1_ps(gainLeft), _mm256_mul_ps(_mm256_set1_ps(stepLeft), lane));
+        __m256 gainR = _mm256_add_ps(_mm256_set1_ps(gainRight), _mm256_mul_ps(_mm256_set1_ps(stepRight), lane));
+        const __m256 advanceL = _mm256_set1_ps(stepLeft * 8.0f);
+        const __m256 advanceR = _mm256_set1_ps(stepRight * 8.0f);
+
+        size_t i = 0;
+        for (; i + 8 <= count; i += 8)
+        {
+            const __m256 s = _mm256_loadu_ps(samples + i);
+            _mm256_storeu_ps(left + i, _mm256_add_ps(_mm256_loadu_ps(left + i), _mm256_mul_ps(s, gainL)));
+            _mm256_storeu_ps(right + i, _mm256_add_ps(_mm256_loadu_ps(right + i), _mm256_mul_ps(s, gainR)));
+            gainL = _mm256_add_ps(gainL, advanceL);
+            gainR = _mm256_add_ps(gainR, advanceR);
+        }
+        return i;
+    }
+
+    __attribute__((target("avx2"))) size_t interleaveAvx2(float *out, const float *left, const float *right, size_t count, float volume)
+    {
+        const __m256 scale = _mm256_set1_ps(volume);
+        const __m256 low = _mm256_set1_ps(-1.0f), high = _mm256_set1_ps(1.0f);
+
+        size_t i = 0;
+        for (; i + 8 <= count; i += 8)
+        {
+            const __m256 l = _mm256_min_ps(_mm256_max_ps(_mm256_mul_ps(_mm256_loadu_ps(left + i), scale), low), high);
+            const __m256 r = _mm256_min_ps(_mm256_max_ps(_mm256_mul_ps(_mm256_loadu_ps(right + i), scale), low), high);
+            // Unpacking works within 128-bit halves: frames 0-1 and 4-5 in `first`, 2-3 and 6-7 in `second`
+            const __m256 first = _mm256_unpacklo_ps(l, r);
+            const __m256 second = _mm256_unpackhi_ps(l, r);
+            _mm256_storeu_ps(out + 2 * i, _mm256_permute2f128_ps(first, second, 0x20));
+            _mm256_storeu_ps(out + 2 * i + 8, _mm256_permute2f128_ps(first, second, 0x31));
+        }
+        return i;
+    }
+#endif
+}
+
+/**
+ * @brief Adds the ramped left and right gains times each sample, 8 (AVX2) or 4 (SSE2) samples per vector step, the tail scalar.
+ */
+void Engine::mixMonoVoice(Utils::SimdLevel level, float *left, float *right, const float *samples, size_t count,
+                          float gainLeft, float gainRight, float stepLeft, float stepRight)
+{
+    size_t done = 0;
+#ifdef AUDIO_MIXER_X86
+    switch (Utils::clampToSupported(level))
+    {
+    case Utils::SimdLevel::SIMD_AVX2:
+        done = mixMonoAvx2(left, right, samples, count, gainLeft, gainRight, stepLeft, stepRight);
+        break;
+    case Utils::SimdLevel::SIMD_SSE:
+        done = mixMonoSse(left, right, samples, count, gainLeft, gainRight, stepLeft, stepRight);
+        break;
+    default:
+        break;
+    }
+#else
+    (void)level;
+#endif
+    mixMonoScalar(left, right, samples, done, count, gainLeft, gainRight, stepLeft, stepRight);
+}
+
+/**
+ * @brief Scales, clips and zips the two channel buffers into L/R frame pairs, 8 (AVX2) or 4 (SSE2) frames per vector step, the tail scalar.
+ */
+void Engine::interleaveStereo(Utils::SimdLevel level, float *out, const float *left, const float *right, size_t count, float volume)
+{
+    size_t done = 0;
+#ifdef AUDIO_MIXER_X86
+    switch (Utils::clampToSupported(level))
+    {
+    case Utils::SimdLevel::SIMD_AVX2:
+        done = interleaveAvx2(out, left, right, count, volume);
+        break;
+    case Utils::SimdLevel::SIMD_SSE:
+        done = interleaveSse(out, left, right, count, volume);
+        break;
+    default:
+        break;
+    }
+#else
+    (void)level;
+#endif
+    interleaveScalar(out, left, right, done, count, volume);
+}
+
+namespace Engine
+{
+    AudioMixer::AudioMixer(size_t poolFrames, Utils::SimdLevel level)
+        : m_level(Utils::clampToSupported(level)), m_pool(std::make_unique<float[]>(poolFrames)), m_poolFrames(poolFrames),
+          m_commands(AUDIO_COMMAND_CAPACITY)
+    {
+    }
+
+    AudioMixer::~AudioMixer()
+    {
+        close();
+    }
+
+    /**
+     * @brief Opens the default playback device through an audio stream whose callback mixes on demand.
+     *
+     * The stream takes AUDIO_SAMPLE_RATE stereo floats and converts them to the device's format
+     * if it differs. SDL_HINT_AUDIO_DEVICE_SAMPLE_FRAMES is only a request: the granted buffer
+     * size is read back and logged along with the latency it implies.
+     */
+    bool AudioMixer::open()
+    {
+        if (m_stream)
+            return true;
+        if (!SDL_InitSubSystem(SDL_INIT_AUDIO))
+        {
+            SDL_LogError(SDL_LOG_CATEGORY_AUDIO, "Audio not initialized: %s", SDL_GetError());
+            return false;
+        }
+
+        SDL_SetHint(SDL_HINT_AUDIO_DEVICE_SAMPLE_FRAMES, std::to_string(AUDIO_DEVICE_FRAMES).c_str());
+        const SDL_AudioSpec spec = {SDL_AUDIO_F32, AUDIO_CHANNELS, AUDIO_SAMPLE_RATE};
+        m_stream = SDL_OpenAudioDeviceStream(SDL_AUDIO_DEVICE_DEFAULT_PLAYBACK, &spec, streamCallback, this);
+        if (!m_stream)
+        {
+            SDL_LogError(SDL_LOG_CATEGORY_AUDIO, "Failed to open an audio device: %s", SDL_GetError());
+            SDL_QuitSubSystem(SDL_INIT_AUDIO);
+            return false;
+        }
+
+        SDL_AudioSpec deviceSpec;
+        int deviceFrames = 0;
+        if (SDL_GetAudioDeviceFormat(SDL_GetAudioStreamDevice(m_stream), &deviceSpec, &deviceFrames) && deviceSpec.freq > 0)
+        {
+            m_deviceFrames = deviceFrames;
+            SDL_Log("Audio: %s driver, %d frames per buffer at %d Hz (%.1f ms), %d voices, %s mix kernels",
+                    SDL_GetCurrentAudioDriver(), deviceFrames, deviceSpec.freq, 1000.0 * deviceFrames / deviceSpec.freq,
+                    AUDIO_MAX_VOICES, Utils::simdLevelName(m_level));
+        }
+
+        if (!SDL_ResumeAudioStreamDevice(m_stream))
+        {
+            SDL_LogError(SDL_LOG_CATEGORY_AUDIO, "Failed to start the audio device: %s", SDL_GetError());
+            close();
+            return false;
+        }
+        return true;
+    }
+
+    void AudioMixer::close()
+    {
+        if (!m_stream)
+            return;
+        // Also closes the device and waits for a callback in progress
+        SDL_DestroyAudioStream(m_stream);
+        m_stream = nullptr;
+        m_deviceFrames = 0;
+        SDL_QuitSubSystem(SDL_INIT_AUDIO);
+    }
+
+    bool AudioMixer::addSound(Common::SoundID id, const float *samples, size_t frames)
+    {
+        if ((int)id < 0 || id >= Common::SoundID::SOUND_COUNT)
+            return false;
+        if (frames > m_poolFrames - m_poolUsed)
+        {
+            SDL_LogError(SDL_LOG_CATEGORY_AUDIO, "Sound %d needs %zu samples, only %zu left in the pool", (int)id, frames,
+                         m_poolFrames - m_poolUsed);
+            return false;
+        }
+
+        std::memcpy(m_pool.get() + m_poolUsed, samples, frames * sizeof(float));
+        m_sounds[(size_t)id] = {(uint32_t)m_poolUsed, (uint32_t)frames};
+        m_poolUsed += frames;
+        return true;
+    }
+
+    bool AudioMixer::loadSound(Common::SoundID id, const std::string &path)
+    {
+        SDL_AudioSpec spec;
+        Uint8 *data = nullptr;
+        Uint32 length = 0;
+        Uint8 *converted = nullptr;
+        int convertedLength = 0;
+        const SDL_AudioSpec mono = {SDL_AUDIO_F32, 1, AUDIO_SAMPLE_RATE};
+        const bool loaded = SDL_LoadWAV(path.c_str(), &spec, &data, &length) &&
+                            SDL_ConvertAudioSamples(&spec, data, (int)length, &mono, &converted, &convertedLength);
+        SDL_free(data);
+        if (loaded)
+        {
+            const bool added = addSound(id, (const float *)converted, (size_t)convertedLength / sizeof(float));
+            SDL_free(converted);
+            return added;
+        }
+        SDL_LogError(SDL_LOG_CATEGORY_AUDIO, "Failed to load sound %s: %s", path.c_str(), SDL_GetError());
+
+        // A short decaying sine, so a missing file is still audible in place
+        const FallbackTone tone = (int)id >= 0 && id < Common::SoundID::SOUND_COUNT ? FALLBACK_TONES[(int)id] : FallbackTone{440.0f, 0.1f};
+        const size_t frames = (size_t)(tone.seconds * AUDIO_SAMPLE_RATE);
+        std::unique_ptr<float[]> samples = std::make_unique<float[]>(frames);
+        for (size_t i = 0; i < frames; i++)
+        {
+            const float t = (float)i / AUDIO_SAMPLE_RATE;
+            samples[i] = 0.5f * std::sin(TWO_PI * tone.frequency * t) * (1.0f - (float)i / (float)frames);
+        }
+        addSound(id, samples.get(), frames);
+        return false;
+    }
+
+    VoiceHandle AudioMixer::play(Common::SoundID id, float volume, float pan, bool loop)
+    {
+        if ((int)id < 0 || id >= Common::SoundID::SOUND_COUNT || m_sounds[(size_t)id].frames == 0)
+            return NO_VOICE;
+
+        Command command;
+        command.kind = CommandKind::COMMAND_PLAY;
+        command.voice = m_nextHandle;
+        command.offset = m_sounds[(size_t)id].offset;
+        command.frames = m_sounds[(size_t)id].frames;
+        command.volume = volume;
+        command.pan = std::clamp(pan, -1.0f, 1.0f);
+        command.loop = loop;
+        if (!push(command))
+            return NO_VOICE;
+
+        const VoiceHandle handle = m_nextHandle;
+        m_nextHandle = m_nextHandle + 1 == NO_VOICE ? 1 : m_nextHandle + 1;
+        return handle;
+    }
+
+    void AudioMixer::stop(VoiceHandle voice)
+    {
+        Command command;
+        command.kind = CommandKind::COMMAND_STOP;
+        command.voice = voice;
+        push(command);
+    }
+
+    void AudioMixer::setVolume(VoiceHandle voice, float volume)
+    {
+        Command command;
+        command.kind = CommandKind::COMMAND_SET_VOLUME;
+        command.voice = voice;
+        command.volume = volume;
+        push(command);
+    }
+
+    bool AudioMixer::push(Command &command)
+    {
+        if (command.voice == NO_VOICE)
+            return false;
+        if (m_commands.tryPush(command))
+            return true;
+        m_commandsDropped++;
+        return false;
+    }
+
+    /**
+     * @brief Frames are mixed in blocks of AUDIO_BLOCK_FRAMES: every voice adds into planar
+     * accumulators, which are then interleaved and clipped into `out`.
+     */
+    void AudioMixer::mix(float *out, size_t frames)
+    {
+        applyCommands();
+        const size_t total = frames;
+        while (frames > 0)
+        {
+            const size_t block = std::min(frames, AUDIO_BLOCK_FRAMES);
+            mixBlock(block);
+            interleaveStereo(m_level, out, m_left, m_right, block, AUDIO_MASTER_VOLUME);
+            out += block * AUDIO_CHANNELS;
+            frames -= block;
+        }
+        m_framesMixed.fetch_add(total, std::memory_order_relaxed);
+    }
+
+    AudioStats AudioMixer::getStats() const
+    {
+        AudioStats stats;
+        stats.framesMixed = m_framesMixed.load(std::memory_order_relaxed);
+        stats.voicesStolen = m_voicesStolen.load(std::memory_order_relaxed);
+        stats.commandsDropped = m_commandsDropped;
+        stats.activeVoices = m_activeVoices.load(std::memory_order_relaxed);
+        stats.peakVoices = m_peakVoices.load(std::memory_order_relaxed);
+        return stats;
+    }
+
+    /**
+     * @brief Mixes exactly the bytes the device asks for, a block at a time through m_output.
+     */
+    void SDLCALL AudioMixer::streamCallback(void *userdata, SDL_AudioStream *stream, int additionalAmount, int totalAmount)
+    {
+        (void)totalAmount;
+        AudioMixer *mixer = (AudioMixer *)userdata;
+        constexpr int frameBytes = (int)sizeof(float) * AUDIO_CHANNELS;
+        size_t frames = (size_t)((additionalAmount + frameBytes - 1) / frameBytes);
+        while (frames > 0)
+        {
+            const size_t block = std::min(frames, AUDIO_BLOCK_FRAMES);
+            mixer->mix(mixer->m_output, block);
+            SDL_PutAudioStreamData(stream, mixer->m_output, (int)block * frameBytes);
+            frames -= block;
+        }
+    }
+
+    void AudioMixer::applyCommands()
+    {
+        Command command;
+        while (m_commands.tryPop(command))
+        {
+            if (command.kind == CommandKind::COMMAND_PLAY)
+            {
+                startVoice(command);
+                continue;
+            }
+            Voice *voice = findVoice(command.voice);
+            if (!voice)
+                continue; // Already finished or stolen
+            if (command.kind == CommandKind::COMMAND_STOP)
+                voice->stopping = true;
+            else
+                voice->volume = command.volume;
+        }
+    }
+
+    /**
+     * @brief Takes a free voice, or else the one closest to finishing (looping voices last).
+     *
+     * The new voice starts at its full gain; only later volume changes and stops are ramped.
+     */
+    void AudioMixer::startVoice(const Command &command)
+    {
+        Voice *target = nullptr;
+        uint32_t fewestLeft = UINT32_MAX;
+        for (Voice &voice : m_voices)
+        {
+            if (voice.handle == NO_VOICE)
+            {
+                target = &voice;
+                break;
+            }
+            const uint32_t left = voice.loop ? UINT32_MAX : voice.frames - voice.position;
+            if (!target || left < fewestLeft)
+            {
+                target = &voice;
+                fewestLeft = left;
+            }
+        }
+        if (target->handle != NO_VOICE)
+            m_voicesStolen.fetch_add(1, std::memory_order_relaxed);
+
+        const float angle = (command.pan + 1.0f) * 0.5f * HALF_PI; // Constant-power pan
+        *target = Voice{};
+        target->handle = command.voice;
+        target->offset = command.offset;
+        target->frames = command.frames;
+        target->volume = command.volume;
+        target->pan = command.pan;
+        target->gainLeft = command.volume * std::cos(angle);
+        target->gainRight = command.volume * std::sin(angle);
+        target->loop = command.loop;
+    }
+
+    AudioMixer::Voice *AudioMixer::findVoice(VoiceHandle handle)
+    {
+        for (Voice &voice : m_voices)
+        {
+            if (voice.handle == handle)
+                return &voice;
+        }
+        return nullptr;
+    }
+
+    /**
+     * @brief Adds every active voice into m_left/m_right, ramping each from the gains it ended the
+     * last block with to its current target, and frees voices that finished or faded out.
+     */
+    void AudioMixer::mixBlock(size_t frames)
+    {
+        std::fill(m_left, m_left + frames, 0.0f);
+        std::fill(m_right, m_right + frames, 0.0f);
+
+        const float *pool = m_pool.get();
+        int active = 0;
+        for (Voice &voice : m_voices)
+        {
+            if (voice.handle == NO_VOICE)
+                continue;
+
+            const float angle = (voice.pan + 1.0f) * 0.5f * HALF_PI;
+            const float volume = voice.stopping ? 0.0f : voice.volume;
+            const float targetLeft = volume * std::cos(angle);
+            const float targetRight = volume * std::sin(angle);
+            const float stepLeft = (targetLeft - voice.gainLeft) / (float)frames;
+            const float stepRight = (targetRight - voice.gainRight) / (float)frames;
+
+            size_t done = 0;
+            while (done < frames)
+            {
+                const size_t run = std::min(frames - done, (size_t)(voice.frames - voice.position));
+                mixMonoVoice(m_level, m_left + done, m_right + done, pool + voice.offset + voice.position, run,
+                             voice.gainLeft + stepLeft * (float)done, voice.gainRight + stepRight * (float)done, stepLeft, stepRight);
+                done += run;
+                voice.position += (uint32_t)run;
+                if (voice.position < voice.frames)
+                    continue;
+                if (!voice.loop)
+                    break;
+                voice.position = 0;
+            }
+            voice.gainLeft = targetLeft;
+            voice.gainRight = targetRight;
+
+            if (voice.stopping || (!voice.loop && voice.position >= voice.frames))
+                voice.handle = NO_VOICE;
+            else
+                active++;
+        }
+
+        m_activeVoices.store(active, std::memory_order_relaxed);
+        if (active > m_peakVoices.load(std::memory_order_relaxed))
+            m_peakVoices.store(active, std::memory_order_relaxed);
+    }
+} // namespace Engine
@@ -0,0 +1,380 @@
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <string>
+#include <vector>
+
+#include "Engine/CpuRenderer.hpp"
+
+#include "Utils/JobSystem.hpp"
+
+#include "Common/Constants.hpp"
+
+namespace
+{
+    constexpr int FRAME_WIDTH = Common::SCREEN_WIDTH;
+    constexpr int FRAME_HEIGHT = Common::SCREEN_HEIGHT;
+    constexpr int TILES_X = (FRAME_WIDTH + Engine::RASTER_TILE_SIZE - 1) / Engine::RASTER_TILE_SIZE;
+    constexpr int TILES_Y = (FRAME_HEIGHT + Engine::RASTER_TILE_SIZE - 1) / Engine::RASTER_TILE_SIZE;
+    constexpr int32_t FIXED_ONE = 1 << 16;
+
+    constexpr uint32_t BLACK_PIXEL = 0xFF000000;
+    constexpr uint32_t BACKGROUND_PIXEL = 0xFF000000 | (uint32_t)Engine::BACKGROUND_GRAY << 16 | (uint32_t)Engine::BACKGROUND_GRAY << 8 |
+                                          (uint32_t)Engine::BACKGROUND_GRAY;
+
+    /**
+     * @brief First pixel whose center is at or right of `edge`, clamped to [0, limit] (top-left fill rule).
+     */
+    int firstPixel(float edge, int limit)
+    {
+        return (int)std::ceil(std::clamp(edge - 0.5f, -1.0f, (float)limit));
+    }
+}
+
+namespace Engine
+{
+    CpuRenderer::CpuRenderer(SDL_Window *window, Utils::JobSystem *jobs)
+        : m_jobs(jobs), m_kernels(getSpanKernels(Utils::detectSimdLevel())),
+          m_framebuffer((size_t)FRAME_WIDTH * FRAME_HEIGHT, BLACK_PIXEL), m_tileBins((size_t)TILES_X * TILES_Y)
+    {
+        SDL_Log("CPU renderer: %d x %d tiles, %s span kernels", TILES_X, TILES_Y, Utils::simdLevelName(Utils::detectSimdLevel()));
+        if (!window)
+            return;
+
+        m_sdlRenderer = SDL_CreateRenderer(window, NULL);
+        if (!m_sdlRenderer)
+        {
+            SDL_LogError(1, "Failed to create renderer: %s", SDL_GetError());
+            return;
+        }
+        SDL_SetRenderLogicalPresentation(m_sdlRenderer, FRAME_WIDTH, FRAME_HEIGHT, SDL_LOGICAL_PRESENTATION_LETTERBOX);
+
+        m_frameTexture = SDL_CreateTexture(m_sdlRenderer, SDL_PIXELFORMAT_ARGB8888, SDL_TEXTUREACCESS_STREAMING, FRAME_WIDTH, FRAME_HEIGHT);
+        if (!m_frameTexture)
+        {
+            SDL_LogError(1, "Failed to create frame texture: %s", SDL_GetError());
+            return;
+        }
+        SDL_SetTextureScaleMode(m_frameTexture, SDL_SCALEMODE_NEAREST);
+        SDL_SetTextureBlendMode(m_frameTexture, SDL_BLENDMODE_NONE);
+    }
+
+    CpuRenderer::~CpuRenderer()
+    {
+        if (m_frameTexture)
+            SDL_DestroyTexture(m_frameTexture);
+        if (m_sdlRenderer)
+            SDL_DestroyRenderer(m_sdlRenderer);
+    }
+
+    /**
+     * @brief Converts a sprite to premultiplied rasterizer pixels and stages it for buildAtlas().
+     */
+    bool CpuRenderer::addTexture(Common::TextureID id, SDL_Surface *surface)
+    {
+        if ((int)id < 0 || id >= Common::TextureID::TEX_COUNT)
+            return false;
+
+        SDL_Surface *converted = SDL_ConvertSurface(surface, SDL_PIXELFORMAT_ARGB8888);
+        if (!converted)
+            return false;
+
+        Sprite &sprite = m_stagedSprites[(size_t)id];
+        sprite.width = converted->w;
+        sprite.height = converted->h;
+        sprite.opaque = true;
+        sprite.pixels.resize((size_t)converted->w * converted->h);
+        for (int y = 0; y < converted->h; y++)
+        {
+            const uint32_t *row = (const uint32_t *)((const uint8_t *)converted->pixels + (size_t)y * converted->pitch);
+            for (int x = 0; x < converted->w; x++)
+            {
+                sprite.pixels[(size_t)y * converted->w + x] = premultiplyArgb(row[x]);
+                sprite.opaque = sprite.opaque && (row[x] >> 24) == 0xFF;
+            }
+        }
+        SDL_DestroySurface(converted);
+        return true;
+    }
+
+    /**
+     * @brief Publishes the staged sprites; there is nothing to pack since each sprite keeps its own pixels.
+     */
+    int CpuRenderer::buildAtlas()
+    {
+        int published = 0;
+        for (size_t id = 0; id < m_stagedSprites.size(); id++)
+        {
+            if (m_stagedSprites[id].pixels.empty())
+                continue;
+            m_sprites[id] = std::move(m_stagedSprites[id]);
+            m_stagedSprites[id] = {};
+            published++;
+        }
+        return published;
+    }
+
+    /**
+     * @brief Starts an empty display list; tiles are cleared to black unless something draws the background.
+     */
+    void CpuRenderer::beginFrame()
+    {
+        m_stats = {};
+        m_primitives.clear();
+        m_clearColor = BLACK_PIXEL;
+    }
+
+    /**
+     * @brief Records every visible chunk's tiles, offset to the chunk's screen position, over the background.
+     */
+    void CpuRenderer::drawStaticChunks(const Utils::FrameVector<Common::StaticChunkCommand> &chunks)
+    {
+        m_clearColor = BACKGROUND_PIXEL;
+        const float chunkSize = (float)Common::CHUNK_PIXELS;
+        for (const Common::StaticChunkCommand &chunk : chunks)
+        {
+            if (chunk.x >= FRAME_WIDTH || chunk.y >= FRAME_HEIGHT || chunk.x + chunkSize <= 0.0f || chunk.y + chunkSize <= 0.0f)
+                continue;
+            m_stats.staticChunksDrawn++;
+            if (!m_staticSource)
+                continue;
+            m_chunkCommands.clear();
+            m_staticSource(chunk.chunkX, chunk.chunkY, m_chunkCommands);
+            pushCommands(m_chunkCommands.data(), m_chunkCommands.size(), chunk.x, chunk.y);
+        }
+    }
+
+    void CpuRenderer::drawCommands(const Utils::FrameVector<Common::RenderCommand> &commands)
+    {
+        m_stats.commandsReceived += commands.size();
+        m_clearColor = BACKGROUND_PIXEL;
+        pushCommands(commands.data(), commands.size(), 0.0f, 0.0f);
+    }
+
+    void CpuRenderer::drawParticles(const Utils::FrameVector<Common::ParticleInstance> &particles)
+    {
+        for (const Common::ParticleInstance &particle : particles)
+        {
+            const uint32_t alpha = particle.color & 0xFF;
+            if (alpha == 0)
+                continue;
+            pushRect(particle.x, particle.y, particle.size, particle.size, alpha == 0xFF ? PrimitiveKind::PRIM_FILL : PrimitiveKind::PRIM_BLEND,
+                     rgbaToPixel(particle.color));
+        }
+        m_stats.particlesDrawn += particles.size();
+    }
+
+    /**
+     * @brief Records `count` commands ordered by layer, then submission order, shifted by (offsetX, offsetY).
+     */
+    void CpuRenderer::pushCommands(const Common::RenderCommand *commands, size_t count, float offsetX, float offsetY)
+    {
+        // Sort key: | layer (32) | command index (32) |
+        m_sortKeys.clear();
+        m_sortKeys.reserve(count);
+        for (size_t i = 0; i < count; i++)
+        {
+            const uint64_t layer = (uint64_t)(uint32_t)(commands[i].layer + 0x80000000u);
+            m_sortKeys.push_back((layer << 32) | (uint64_t)i);
+        }
+        std::sort(m_sortKeys.begin(), m_sortKeys.end());
+
+        for (uint64_t key : m_sortKeys)
+        {
+            const Common::RenderCommand &cmd = commands[(size_t)(key & 0xFFFFFFFF)];
+            const bool hasSprite = (int)cmd.textureID >= 0 && cmd.textureID < Common::TextureID::TEX_COUNT &&
+                                   !m_sprites[(size_t)cmd.textureID].pixels.empty();
+            if (hasSprite)
+                pushSprite(cmd, offsetX, offsetY, m_sprites[(size_t)cmd.textureID]);
+            else
+                pushRect(cmd.x + offsetX, cmd.y + offsetY, cmd.width, cmd.height, PrimitiveKind::PRIM_FILL, rgbaToPixel(getFallbackColor(cmd.textureID)));
+        }
+    }
+
+    void CpuRenderer::pushRect(float x, float y, float width, float height, PrimitiveKind kind, uint32_t color)
+    {
+        Primitive primitive{};
+        primitive.x0 = std::max(firstPixel(x, FRAME_WIDTH), 0);
+        primitive.y0 = std::max(firstPixel(y, FRAME_HEIGHT), 0);
+        primitive.x1 = firstPixel(x + width, FRAME_WIDTH);
+        primitive.y1 = firstPixel(y + height, FRAME_HEIGHT);
+        if (primitive.x0 >= primitive.x1 || primitive.y0 >= primitive.y1)
+            return;
+        primitive.kind = kind;
+        primitive.color = color;
+        m_primitives.push_back(primitive);
+    }
+
+    /**
+     * @brief Records a sprite-mapped rectangle: the command's UV rectangle, in sprite pixels, stretched over its destination.
+     */
+    void CpuRenderer::pushSprite(const Common::RenderCommand &cmd, float offsetX, float offsetY, const Sprite &sprite)
+    {
+        const float x = cmd.x + offsetX, y = cmd.y + offsetY;
+        Primitive primitive{};
+        primitive.x0 = std::max(firstPixel(x, FRAME_WIDTH), 0);
+        primitive.y0 = std::max(firstPixel(y, FRAME_HEIGHT), 0);
+        primitive.x1 = firstPixel(x + cmd.width, FRAME_WIDTH);
+        primitive.y1 = firstPixel(y + cmd.height, FRAME_HEIGHT);
+        if (primitive.x0 >= primitive.x1 || primitive.y0 >= primitive.y1)
+            return;
+
+        const double scaleX = (double)(cmd.u1 - cmd.u0) * sprite.width / cmd.width;
+        const double scaleY = (double)(cmd.v1 - cmd.v0) * sprite.height / cmd.height;
+        primitive.u = (int32_t)std::floor(((double)cmd.u0 * sprite.width + (primitive.x0 + 0.5 - x) * scaleX) * FIXED_ONE);
+        primitive.v = (int32_t)std::floor(((double)cmd.v0 * sprite.height + (primitive.y0 + 0.5 - y) * scaleY) * FIXED_ONE);
+        primitive.du = (int32_t)std::lround(scaleX * FIXED_ONE);
+        primitive.dv = (int32_t)std::lround(scaleY * FIXED_ONE);
+        primitive.kind = sprite.opaque ? PrimitiveKind::PRIM_SPRITE_COPY : PrimitiveKind::PRIM_SPRITE_BLEND;
+        primitive.sprite = &sprite;
+        m_primitives.push_back(primitive);
+    }
+
+    /**
+     * @brief Appends every primitive's index to the bins of the tiles it overlaps, keeping submission order per tile.
+     */
+    void CpuRenderer::binPrimitives()
+    {
+        for (std::vector<uint32_t> &bin : m_tileBins)
+            bin.clear();
+
+        for (size_t i = 0; i < m_primitives.size(); i++)
+        {
+            const Primitive &primitive = m_primitives[i];
+            const int tileX1 = (primitive.x1 - 1) / RASTER_TILE_SIZE;
+            const int tileY1 = (primitive.y1 - 1) / RASTER_TILE_SIZE;
+            for (int tileY = primitive.y0 / RASTER_TILE_SIZE; tileY <= tileY1; tileY++)
+            {
+                for (int tileX = primitive.x0 / RASTER_TILE_SIZE; tileX <= tileX1; tileX++)
+                    m_tileBins[(size_t)tileY * TILES_X + tileX].push_back((uint32_t)i);
+            }
+        }
+    }
+
+    /**
+     * @brief Clears one tile and paints its primitives, clipped to the tile, in submission order.
+     */
+    void CpuRenderer::rasterizeTile(size_t tile)
+    {
+        const int tileX0 = (int)(tile % TILES_X) * RASTER_TILE_SIZE;
+        const int tileY0 = (int)(tile / TILES_X) * RASTER_TILE_SIZE;
+        const int tileX1 = std::min(tileX0 + RASTER_TILE_SIZE, FRAME_WIDTH);
+        const int tileY1 = std::min(tileY0 + RASTER_TILE_SIZE, FRAME_HEIGHT);
+        uint32_t *pixels = m_framebuffer.data();
+
+        for (int y = tileY0; y < tileY1; y++)
+            m_kernels.fill(pixels + (size_t)y * FRAME_WIDTH + tileX0, (size_t)(tileX1 - tileX0), m_clearColor);
+
+        for (uint32_t index : m_tileBins[tile])
+        {
+            const Primitive &primitive = m_primitives[index];
+            const int x0 = std::max(primitive.x0, tileX0), x1 = std::min(primitive.x1, tileX1);
+            const int y0 = std::max(primitive.y0, tileY0), y1 = std::min(primitive.y1, tileY1);
+            const size_t width = (size_t)(x1 - x0);
+
+            switch (primitive.kind)
+            {
+            case PrimitiveKind::PRIM_FILL:
+                for (int y = y0; y < y1; y++)
+                    m_kernels.fill(pixels + (size_t)y * FRAME_WIDTH + x0, width, primitive.color);
+                break;
+            case PrimitiveKind::PRIM_BLEND:
+                for (int y = y0; y < y1; y++)
+                    m_kernels.blendColor(pixels + (size_t)y * FRAME_WIDTH + x0, width, primitive.color);
+                break;
+            default:
+                rasterizeSprite(primitive, x0, y0, x1, y1);
+                break;
+            }
+        }
+    }
+
+    /**
+     * @brief Samples the sprite nearest-neighbour over [x0, x1) x [y0, y1), which lies within one tile.
+     *
+     * Source columns only depend on x, so they are computed once; rows whose columns are consecutive
+     * and inside the sprite (unscaled sprites) are read in place instead of gathered.
+     */
+    void CpuRenderer::rasterizeSprite(const Primitive &primitive, int x0, int y0, int x1, int y1)
+    {
+        const Sprite &sprite = *primitive.sprite;
+        const int count = x1 - x0;
+
+        int columns[RASTER_TILE_SIZE];
+        for (int i = 0; i < count; i++)
+        {
+            const int64_t u = primitive.u + (int64_t)(x0 - primitive.x0 + i) * primitive.du;
+            columns[i] = (int)std::clamp<int64_t>(u >> 16, 0, sprite.width - 1);
+        }
+        const bool contiguous = primitive.du == FIXED_ONE && columns[count - 1] - columns[0] == count - 1;
+
+        uint32_t samples[RASTER_TILE_SIZE];
+        const uint32_t *sampledRow = nullptr; // Magnified sprites repeat source rows; their samples are reused
+        for (int y = y0; y < y1; y++)
+        {
+            const int64_t v = primitive.v + (int64_t)(y - primitive.y0) * primitive.dv;
+            const uint32_t *sourceRow = sprite.pixels.data() + (size_t)std::clamp<int64_t>(v >> 16, 0, sprite.height - 1) * sprite.width;
+
+            const uint32_t *source = sourceRow + columns[0];
+            if (!contiguous)
+            {
+                if (sourceRow != sampledRow)
+                {
+                    for (int i = 0; i < count; i++)
+                        samples[i] = sourceRow[columns[i]];
+                    sampledRow = sourceRow;
+                }
+                source = samples;
+            }
+
+            uint32_t *destination = m_framebuffer.data() + (size_t)y * FRAME_WIDTH + x0;
+            if (primitive.kind == PrimitiveKind::PRIM_SPRITE_COPY)
+                std::memcpy(destination, source, (size_t)count * sizeof(uint32_t));
+            else
+                m_kernels.blendPixels(destination, source, (size_t)count);
+        }
+    }
+
+    /**
+     * @brief Rasterizes the recorded frame tile by tile, captures it if requested and uploads and presents it.
+     */
+    void CpuRenderer::endFrame()
+    {
+        binPrimitives();
+        const size_t tileCount = m_tileBins.size();
+        if (m_jobs)
+        {
+            m_jobs->parallelFor(tileCount, 4, [this](size_t begin, size_t end)
+                                {
+                for (size_t tile = begin; tile < end; tile++)
+                    rasterizeTile(tile); });
+        }
+        else
+        {
+            for (size_t tile = 0; tile < tileCount; tile++)
+                rasterizeTile(tile);
+        }
+
+        if (!m_capturePath.empty())
+            saveCapture();
+        if (!m_frameTexture)
+            return;
+
+        SDL_UpdateTexture(m_frameTexture, nullptr, m_framebuffer.data(), FRAME_WIDTH * (int)sizeof(uint32_t));
+        SDL_SetRenderDrawColor(m_sdlRenderer, 0, 0, 0, 255);
+        SDL_RenderClear(m_sdlRenderer);
+        SDL_RenderTexture(m_sdlRenderer, m_frameTexture, nullptr, nullptr);
+        m_stats.drawCalls++;
+        SDL_RenderPresent(m_sdlRenderer);
+    }
+
+    void CpuRenderer::saveCapture()
+    {
+        SDL_Surface *frame = SDL_CreateSurfaceFrom(FRAME_WIDTH, FRAME_HEIGHT, SDL_PIXELFORMAT_ARGB8888, m_framebuffer.data(),
+                                                   FRAME_WIDTH * (int)sizeof(uint32_t));
+        if (!frame || !SDL_SaveBMP(frame, m_capturePath.c_str()))
+            SDL_LogError(1, "Failed to capture frame to %s: %s", m_capturePath.c_str(), SDL_GetError());
+        SDL_DestroySurface(frame);
+        m_capturePath.clear();
+    }
+} // namespace Engine
@@ -0,0 +1,124 @@
+#include <SDL3/SDL.h>
+#include <algorithm>
+#include <atomic>
+#include <thread>
+
+#include "Engine/FramePipeline.hpp"
+#include "Utils/Profiler.hpp"
+
+namespace Engine
+{
+    /**
+     * @brief Stores the simulation callback and starts the simulation thread, idle until the first kick().
+     *
+     * @param simulate Per-frame simulation callback, run on the simulation thread.
+     */
+    FramePipeline::FramePipeline(SimulateFn simulate)
+        : m_simulate(std::move(simulate))
+    {
+        m_thread = std::thread(&FramePipeline::threadLoop, this);
+    }
+
+    /**
+     * @brief Lets an in-flight frame finish, then stops and joins the simulation thread and logs how full the arenas got.
+     */
+    FramePipeline::~FramePipeline()
+    {
+        int state = m_state.load(std::memory_order_acquire);
+        while (state == STATE_KICKED)
+        {
+            m_state.wait(state, std::memory_order_acquire);
+            state = m_state.load(std::memory_order_acquire);
+        }
+        m_state.store(STATE_STOP, std::memory_order_release);
+        m_state.notify_one();
+        m_thread.join();
+
+        Utils::ArenaStats total;
+        for (const FramePacket &packet : m_packets)
+        {
+            const Utils::ArenaStats stats = packet.arena.getStats();
+            total.capacity = stats.capacity;
+            total.highWaterMark = std::max(total.highWaterMark, stats.highWaterMark);
+            total.overflowAllocations += stats.overflowAllocations;
+            total.overflowBytes += stats.overflowBytes;
+        }
+        SDL_Log("Frame arenas: peak %.1f of %.1f KiB per frame, %zu allocations (%.1f KiB) fell back to the heap",
+                total.highWaterMark / 1024.0, total.capacity / 1024.0, total.overflowAllocations, total.overflowBytes / 1024.0);
+    }
+
+    /**
+     * @brief Publishes the frame input and wakes the simulation thread.
+     *
+     * The release store on the state makes the input and the current front index visible to the
+     * simulation thread before it starts.
+     */
+    void FramePipeline::kick(const FrameInput &frame)
+    {
+        m_pendingInput = frame;
+        m_state.store(STATE_KICKED, std::memory_order_release);
+        m_state.notify_one();
+    }
+
+    /**
+     * @brief Waits for the simulation to finish, then swaps the finished back packet to the front.
+     *
+     * If nothing was kicked, the current front packet is returned unchanged.
+     */
+    const FramePacket &FramePipeline::waitForFrame()
+    {
+        int state = m_state.load(std::memory_order_acquire);
+        if (state == STATE_IDLE)
+            return m_packets[m_front];
+
+        while (state != STATE_DONE)
+        {
+            m_state.wait(state, std::memory_order_acquire);
+            state = m_state.load(std::memory_order_acquire);
+        }
+
+        m_front = 1 - m_front;
+        m_state.store(STATE_IDLE, std::memory_order_relaxed);
+        return m_packets[m_front];
+    }
+
+    void FramePipeline::threadLoop()
+    {
+        PROFILE_THREAD("Simulation");
+        while (true)
+        {
+            int state = m_state.load(std::memory_order_acquire);
+            while (state != STATE_KICKED && state != STATE_STOP)
+            {
+                m_state.wait(state, std::memory_order_acquire);
+                state = m_state.load(std::memory_order_acquire);
+            }
+            if (state == STATE_STOP)
+                return;
+
+            // Drop the old lists before rewinding the arena they live in, then size the new ones like
+            // this packet's last frame so they rarely grow (growth leaves dead copies in the arena)
+            FramePacket &packet = m_packets[1 - m_front];
+            const size_t lastCommandCount = packet.commands.size();
+            const size_t lastChunkCount = packet.staticChunks.size();
+            const size_t lastParticleCount = packet.particles.size();
+            packet.commands = Utils::FrameVector<Common::RenderCommand>(Utils::FrameAllocator<Common::RenderCommand>(&packet.arena));
+            packet.staticChunks = Utils::FrameVector<Common::StaticChunkCommand>(Utils::FrameAllocator<Common::StaticChunkCommand>(&packet.arena));
+            packet.particles = Utils::FrameVector<Common::ParticleInstance>(Utils::FrameAllocator<Common::ParticleInstance>(&packet.arena));
+            packet.sounds = Utils::FrameVector<Common::SoundEvent>(Utils::FrameAllocator<Common::SoundEvent>(&packet.arena));
+            packet.arena.reset();
+            packet.commands.reserve(lastCommandCount);
+            packet.staticChunks.reserve(lastChunkCount);
+            packet.particles.reserve(lastParticleCount);
+
+            packet.frameIndex = ++m_frameIndex;
+            {
+                PROFILE_ZONE("simulate");
+                m_simulate(m_pendingInput, packet);
+            }
+
+            m_state.store(STATE_DONE, std::memory_order_release);
+            m_state.notify_all();
+        }
+    }
+} // namespace Engine
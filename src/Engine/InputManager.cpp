@@ -0,0 +1,186 @@
+#include "Engine/InputManager.hpp"
+
+namespace
+{
+    /**
+     * @brief Converts held-action flags into the InputState the simulation consumes.
+     */
+    Common::InputState toInputState(const std::array<bool, (size_t)Engine::Action::ACTION_COUNT> &held)
+    {
+        Common::InputState state;
+        state.up = held[(size_t)Engine::Action::ACTION_UP];
+        state.down = held[(size_t)Engine::Action::ACTION_DOWN];
+        state.left = held[(size_t)Engine::Action::ACTION_LEFT];
+        state.right = held[(size_t)Engine::Action::ACTION_RIGHT];
+        state.jump = held[(size_t)Engine::Action::ACTION_JUMP];
+        state.attack = held[(size_t)Engine::Action::ACTION_ATTACK];
+        return state;
+    }
+}
+
+namespace Engine
+{
+    ActionBindings::ActionBindings()
+    {
+        m_keys.fill(Action::ACTION_NONE);
+        m_mouseButtons.fill(Action::ACTION_NONE);
+
+        bindKey(SDL_SCANCODE_W, Action::ACTION_UP);
+        bindKey(SDL_SCANCODE_S, Action::ACTION_DOWN);
+        bindKey(SDL_SCANCODE_A, Action::ACTION_LEFT);
+        bindKey(SDL_SCANCODE_D, Action::ACTION_RIGHT);
+        bindKey(SDL_SCANCODE_SPACE, Action::ACTION_JUMP);
+        bindKey(SDL_SCANCODE_F11, Action::ACTION_TOGGLE_FULLSCREEN);
+        bindMouseButton(SDL_BUTTON_LEFT, Action::ACTION_ATTACK);
+    }
+
+    void ActionBindings::bindKey(SDL_Scancode scancode, Action action)
+    {
+        if (scancode > SDL_SCANCODE_UNKNOWN && scancode < SDL_SCANCODE_COUNT)
+            m_keys[scancode] = action;
+    }
+
+    void ActionBindings::bindMouseButton(Uint8 button, Action action)
+    {
+        if (button < MOUSE_BUTTON_COUNT)
+            m_mouseButtons[button] = action;
+    }
+
+    void ActionBindings::unbind(Action action)
+    {
+        for (Action &bound : m_keys)
+        {
+            if (bound == action)
+                bound = Action::ACTION_NONE;
+        }
+        for (Action &bound : m_mouseButtons)
+        {
+            if (bound == action)
+                bound = Action::ACTION_NONE;
+        }
+    }
+
+    Action ActionBindings::forKey(SDL_Scancode scancode) const
+    {
+        return scancode >= 0 && scancode < SDL_SCANCODE_COUNT ? m_keys[scancode] : Action::ACTION_NONE;
+    }
+
+    Action ActionBindings::forMouseButton(Uint8 button) const
+    {
+        return button < MOUSE_BUTTON_COUNT ? m_mouseButtons[button] : Action::ACTION_NONE;
+    }
+
+    Common::InputState InputManager::update()
+    {
+        bool toggleFullScreen = false;
+        SDL_Event event;
+
+        while (SDL_PollEvent(&event))
+        {
+            switch (event.type)
+            {
+            case SDL_EVENT_QUIT:
+                m_quit = true;
+                break;
+            case SDL_EVENT_KEY_DOWN:
+            case SDL_EVENT_KEY_UP:
+            {
+                const Action action = m_bindings.forKey(event.key.scancode);
+                if (action == Action::ACTION_NONE || event.key.repeat)
+                    break;
+                if (action == Action::ACTION_TOGGLE_FULLSCREEN && event.key.down)
+                    toggleFullScreen = true;
+                push(event.key.timestamp, action, event.key.down);
+                break;
+            }
+            case SDL_EVENT_MOUSE_BUTTON_DOWN:
+            case SDL_EVENT_MOUSE_BUTTON_UP:
+            {
+                const Action action = m_bindings.forMouseButton(event.button.button);
+                if (action != Action::ACTION_NONE)
+                    push(event.button.timestamp, action, event.button.down);
+                break;
+            }
+            case SDL_EVENT_WINDOW_FOCUS_LOST:
+                for (size_t action = 0; action < m_held.size(); action++)
+                {
+                    if (m_held[action])
+                        push(event.window.timestamp, (Action)action, false);
+                }
+                break;
+            default:
+                break;
+            }
+        }
+
+        Common::InputState state = toInputState(m_held);
+        state.toggleFullScreen = toggleFullScreen;
+        state.quit = m_quit;
+        return state;
+    }
+
+    void InputManager::drainEvents(std::vector<InputEvent> &out)
+    {
+        for (size_t i = 0; i < m_count; i++)
+        {
+            out.push_back(m_queue[(m_head + i) % INPUT_QUEUE_CAPACITY]);
+        }
+        m_head = 0;
+        m_count = 0;
+    }
+
+    /**
+     * @brief Records a transition of a held action; presses of held actions and stray releases are dropped.
+     *
+     * A full buffer drops its oldest event, with a warning the first time so lost input shows up in the log.
+     */
+    void InputManager::push(uint64_t timestamp, Action action, bool pressed)
+    {
+        bool &held = m_held[(size_t)action];
+        if (held == pressed)
+            return;
+        held = pressed;
+
+        if (m_count == INPUT_QUEUE_CAPACITY)
+        {
+            m_head = (m_head + 1) % INPUT_QUEUE_CAPACITY;
+            m_count--;
+            if (m_dropped++ == 0)
+                SDL_LogWarn(SDL_LOG_CATEGORY_INPUT, "Input buffer full (%zu events); dropping the oldest events", INPUT_QUEUE_CAPACITY);
+        }
+        m_queue[(m_head + m_count) % INPUT_QUEUE_CAPACITY] = {timestamp, action, pressed};
+        m_count++;
+    }
+
+    void InputTickBuilder::push(const std::vector<InputEvent> &events)
+    {
+        // Compact the applied prefix away before growing, so the buffer stays at a few frames of events
+        if (m_next > 0)
+        {
+            m_pending.erase(m_pending.begin(), m_pending.begin() + m_next);
+            m_next = 0;
+        }
+        m_pending.insert(m_pending.end(), events.begin(), events.end());
+    }
+
+    Common::InputState InputTickBuilder::buildTick(uint64_t tickEnd)
+    {
+        bool jumpPressed = false;
+        bool attackPressed = false;
+        while (m_next < m_pending.size() && m_pending[m_next].timestamp <= tickEnd)
+        {
+            const InputEvent &event = m_pending[m_next++];
+            m_held[(size_t)event.action] = event.pressed;
+            if (event.pressed)
+            {
+                jumpPressed |= event.action == Action::ACTION_JUMP;
+                attackPressed |= event.action == Action::ACTION_ATTACK;
+            }
+        }
+
+        Common::InputState state = toInputState(m_held);
+        state.jump |= jumpPressed;
+        state.attack |= attackPressed;
+        return state;
+    }
+} // namespace Engine
@@ -0,0 +1,117 @@
+#include <SDL3/SDL.h>
+#include <cstdio>
+#include <cstring>
+
+#include "Engine/InputRecording.hpp"
+
+#include "Common/Constants.hpp"
+
+namespace
+{
+    constexpr char RECORDING_MAGIC[4] = {'R', 'P', 'L', 'Y'};
+    constexpr size_t RECORDING_HEADER_SIZE = 16;
+
+    void writeU32(uint8_t *out, uint32_t value)
+    {
+        for (int i = 0; i < 4; i++)
+        {
+            out[i] = (uint8_t)(value >> (8 * i));
+        }
+    }
+
+    uint32_t readU32(const uint8_t *in)
+    {
+        return (uint32_t)in[0] | (uint32_t)in[1] << 8 | (uint32_t)in[2] << 16 | (uint32_t)in[3] << 24;
+    }
+}
+
+namespace Engine
+{
+    uint8_t packInput(const Common::InputState &input)
+    {
+        return (uint8_t)(input.up << 0 | input.down << 1 | input.left << 2 | input.right << 3 |
+                         input.jump << 4 | input.attack << 5 | input.toggleFullScreen << 6 | input.quit << 7);
+    }
+
+    Common::InputState unpackInput(uint8_t bits)
+    {
+        Common::InputState input;
+        input.up = bits & (1 << 0);
+        input.down = bits & (1 << 1);
+        input.left = bits & (1 << 2);
+        input.right = bits & (1 << 3);
+        input.jump = bits & (1 << 4);
+        input.attack = bits & (1 << 5);
+        input.toggleFullScreen = bits & (1 << 6);
+        input.quit = bits & (1 << 7);
+        return input;
+    }
+
+    bool InputRecording::save(const std::string &path) const
+    {
+        std::FILE *file = std::fopen(path.c_str(), "wb");
+        if (!file)
+        {
+            SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Could not open input recording %s for writing", path.c_str());
+            return false;
+        }
+
+        uint8_t header[RECORDING_HEADER_SIZE];
+        std::memcpy(header, RECORDING_MAGIC, sizeof(RECORDING_MAGIC));
+        writeU32(header + 4, INPUT_RECORDING_VERSION);
+        writeU32(header + 8, (uint32_t)Common::TARGET_FPS);
+        writeU32(header + 12, (uint32_t)m_ticks.size());
+
+        const bool written = std::fwrite(header, 1, sizeof(header), file) == sizeof(header) &&
+                             std::fwrite(m_ticks.data(), 1, m_ticks.size(), file) == m_ticks.size();
+        const bool closed = std::fclose(file) == 0;
+        if (!written || !closed)
+        {
+            SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Failed to write input recording %s", path.c_str());
+            return false;
+        }
+        return true;
+    }
+
+    bool InputRecording::load(const std::string &path)
+    {
+        m_ticks.clear();
+
+        std::FILE *file = std::fopen(path.c_str(), "rb");
+        if (!file)
+        {
+            SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Could not open input recording %s", path.c_str());
+            return false;
+        }
+
+        uint8_t header[RECORDING_HEADER_SIZE];
+        if (std::fread(header, 1, sizeof(header), file) != sizeof(header) ||
+            std::memcmp(header, RECORDING_MAGIC, sizeof(RECORDING_MAGIC)) != 0)
+        {
+            SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "%s is not an input recording", path.c_str());
+            std::fclose(file);
+            return false;
+        }
+
+        const uint32_t version = readU32(header + 4);
+        const uint32_t tickRate = readU32(header + 8);
+        if (version != INPUT_RECORDING_VERSION || tickRate != (uint32_t)Common::TARGET_FPS)
+        {
+            SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Input recording %s has version %u at %u ticks/s, expected version %u at %u ticks/s",
+                         path.c_str(), version, tickRate, INPUT_RECORDING_VERSION, (uint32_t)Common::TARGET_FPS);
+            std::fclose(file);
+            return false;
+        }
+
+        m_ticks.resize(readU32(header + 12));
+        const bool complete = std::fread(m_ticks.data(), 1, m_ticks.size(), file) == m_ticks.size();
+        std::fclose(file);
+        if (!complete)
+        {
+            SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Input recording %s is truncated", path.c_str());
+            m_ticks.clear();
+            return false;
+        }
+        return true;
+    }
+} // namespace Engine
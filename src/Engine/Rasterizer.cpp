@@ -0,0 +1,197 @@
+#include <algorithm>
+
+#include "Engine/Rasterizer.hpp"
+
+#if defined(__x86_64__) || defined(__i386__)
+#define RASTERIZER_X86 1
+#include <immintrin.h>
+#endif
+
+namespace
+{
+    /**
+     * @brief Blends one pixel two channels at a time (red/blue, then alpha/green), each in its own 16-bit half.
+     *
+     * The rounded division by 255 is (x + 128 + ((x + 128) >> 8)) >> 8, as in the SIMD variants. Premultiplied
+     * sources cannot overflow a channel, so the final add needs no saturation.
+     */
+    inline uint32_t blendPixel(uint32_t src, uint32_t dst)
+    {
+        const uint32_t inverse = 255 - (src >> 24);
+        uint32_t redBlue = (dst & 0x00FF00FF) * inverse + 0x00800080;
+        redBlue = ((redBlue + ((redBlue >> 8) & 0x00FF00FF)) >> 8) & 0x00FF00FF;
+        uint32_t alphaGreen = ((dst >> 8) & 0x00FF00FF) * inverse + 0x00800080;
+        alphaGreen = (alphaGreen + ((alphaGreen >> 8) & 0x00FF00FF)) & 0xFF00FF00;
+        return src + (redBlue | alphaGreen);
+    }
+
+    void fillScalar(uint32_t *dst, size_t count, uint32_t color)
+    {
+        std::fill(dst, dst + count, color);
+    }
+
+    void blendColorScalar(uint32_t *dst, size_t count, uint32_t color)
+    {
+        for (size_t i = 0; i < count; i++)
+            dst[i] = blendPixel(color, dst[i]);
+    }
+
+    void blendPixelsScalar(uint32_t *dst, const uint32_t *src, size_t count)
+    {
+        for (size_t i = 0; i < count; i++)
+            dst[i] = blendPixel(src[i], dst[i]);
+    }
+
+#ifdef RASTERIZER_X86
+    inline __m128i div255Sse(__m128i x)
+    {
+        x = _mm_add_epi16(x, _mm_set1_epi16(128));
+        return _mm_srli_epi16(_mm_add_epi16(x, _mm_srli_epi16(x, 8)), 8);
+    }
+
+    /**
+     * @brief Blends four pixels: channels are widened to 16 bits, two pixels per register half.
+     */
+    inline __m128i blendSse(__m128i src, __m128i dst)
+    {
+        const __m128i zero = _mm_setzero_si128();
+        __m128i alpha = _mm_srli_epi32(src, 24);
+        alpha = _mm_or_si128(alpha, _mm_slli_epi32(alpha, 16));
+        const __m128i inverse = _mm_sub_epi16(_mm_set1_epi16(255), alpha);
+        const __m128i low = div255Sse(_mm_mullo_epi16(_mm_unpacklo_epi8(dst, zero), _mm_unpacklo_epi32(inverse, inverse)));
+        const __m128i high = div255Sse(_mm_mullo_epi16(_mm_unpackhi_epi8(dst, zero), _mm_unpackhi_epi32(inverse, inverse)));
+        return _mm_add_epi8(src, _mm_packus_epi16(low, high));
+    }
+
+    void fillSse(uint32_t *dst, size_t count, uint32_t color)
+    {
+        const __m128i value = _mm_set1_epi32((int)color);
+        size_t i = 0;
+        for (; i + 4 <= count; i += 4)
+            _mm_storeu_si128((__m128i *)(dst + i), value);
+        fillScalar(dst + i, count - i, color);
+    }
+
+    void blendColorSse(uint32_t *dst, size_t count, uint32_t color)
+    {
+        const __m128i src = _mm_set1_epi32((int)color);
+        size_t i = 0;
+        for (; i + 4 <= count; i += 4)
+            _mm_storeu_si128((__m128i *)(dst + i), blendSse(src, _mm_loadu_si128((const __m128i *)(dst + i))));
+        if (i < count)
+        {
+            alignas(16) uint32_t tail[4] = {};
+            std::copy(dst + i, dst + count, tail);
+            _mm_store_si128((__m128i *)tail, blendSse(src, _mm_load_si128((const __m128i *)tail)));
+            std::copy(tail, tail + (count - i), dst + i);
+        }
+    }
+
+    void blendPixelsSse(uint32_t *dst, const uint32_t *src, size_t count)
+    {
+        size_t i = 0;
+        for (; i + 4 <= count; i += 4)
+        {
+            const __m128i s = _mm_loadu_si128((const __m128i *)(src + i));
+            _mm_storeu_si128((__m128i *)(dst + i), blendSse(s, _mm_loadu_si128((const __m128i *)(dst + i))));
+        }
+        // The last 1-3 pixels go through a zero-padded register rather than the scalar loop
+        if (i < count)
+        {
+            alignas(16) uint32_t sourceTail[4] = {}, tail[4] = {};
+            std::copy(src + i, src + count, sourceTail);
+            std::copy(dst + i, dst + count, tail);
+            _mm_store_si128((__m128i *)tail, blendSse(_mm_load_si128((const __m128i *)sourceTail), _mm_load_si128((const __m128i *)tail)));
+            std::copy(tail, tail + (count - i), dst + i);
+        }
+    }
+
+    __attribute__((target("avx2"))) inline __m256i div255Avx2(__m256i x)
+    {
+        x = _mm256_add_epi16(x, _mm256_set1_epi16(128));
+        return _mm256_srli_epi16(_mm256_add_epi16(x, _mm256_srli_epi16(x, 8)), 8);
+    }
+
+    // Same as blendSse on eight pixels; unpack and pack both work per 128-bit lane, so pixels stay in place
+    __attribute__((target("avx2"))) inline __m256i blendAvx2(__m256i src, __m256i dst)
+    {
+        const __m256i zero = _mm256_setzero_si256();
+        __m256i alpha = _mm256_srli_epi32(src, 24);
+        alpha = _mm256_or_si256(alpha, _mm256_slli_epi32(alpha, 16));
+        const __m256i inverse = _mm256_sub_epi16(_mm256_set1_epi16(255), alpha);
+        const __m256i low = div255Avx2(_mm256_mullo_epi16(_mm256_unpacklo_epi8(dst, zero), _mm256_unpacklo_epi32(inverse, inverse)));
+        const __m256i high = div255Avx2(_mm256_mullo_epi16(_mm256_unpackhi_epi8(dst, zero), _mm256_unpackhi_epi32(inverse, inverse)));
+        return _mm256_add_epi8(src, _mm256_packus_epi16(low, high));
+    }
+
+    __attribute__((target("avx2"))) void fillAvx2(uint32_t *dst, size_t count, uint32_t color)
+    {
+        const __m256i value = _mm256_set1_epi32((int)color);
+        size_t i = 0;
+        for (; i + 8 <= count; i += 8)
+            _mm256_storeu_si256((__m256i *)(dst + i), value);
+        fillSse(dst + i, count - i, color);
+    }
+
+    __attribute__((target("avx2"))) void blendColorAvx2(uint32_t *dst, size_t count, uint32_t color)
+    {
+        const __m256i src = _mm256_set1_epi32((int)color);
+        size_t i = 0;
+        for (; i + 8 <= count; i += 8)
+            _mm256_storeu_si256((__m256i *)(dst + i), blendAvx2(src, _mm256_loadu_si256((const __m256i *)(dst + i))));
+        blendColorSse(dst + i, count - i, color);
+    }
+
+    __attribute__((target("avx2"))) void blendPixelsAvx2(uint32_t *dst, const uint32_t *src, size_t count)
+    {
+        size_t i = 0;
+        for (; i + 8 <= count; i += 8)
+        {
+            const __m256i s = _mm256_loadu_si256((const __m256i *)(src + i));
+            _mm256_storeu_si256((__m256i *)(dst + i), blendAvx2(s, _mm256_loadu_si256((const __m256i *)(dst + i))));
+        }
+        blendPixelsSse(dst + i, src + i, count - i);
+    }
+#endif
+
+    constexpr Engine::SpanKernels SCALAR_KERNELS = {fillScalar, blendColorScalar, blendPixelsScalar};
+#ifdef RASTERIZER_X86
+    constexpr Engine::SpanKernels SSE_KERNELS = {fillSse, blendColorSse, blendPixelsSse};
+    constexpr Engine::SpanKernels AVX2_KERNELS = {fillAvx2, blendColorAvx2, blendPixelsAvx2};
+#endif
+}
+
+const Engine::SpanKernels &Engine::getSpanKernels(Utils::SimdLevel level)
+{
+#ifdef RASTERIZER_X86
+    switch (Utils::clampToSupported(level))
+    {
+    case Utils::SimdLevel::SIMD_AVX2:
+        return AVX2_KERNELS;
+    case Utils::SimdLevel::SIMD_SSE:
+        return SSE_KERNELS;
+    default:
+        break;
+    }
+#else
+    (void)level;
+#endif
+    return SCALAR_KERNELS;
+}
+
+uint32_t Engine::rgbaToPixel(uint32_t rgba)
+{
+    return premultiplyArgb((rgba << 24) | (rgba >> 8));
+}
+
+uint32_t Engine::premultiplyArgb(uint32_t argb)
+{
+    const uint32_t alpha = argb >> 24;
+    uint32_t result = alpha << 24;
+    for (uint32_t shift = 0; shift < 24; shift += 8)
+    {
+        const uint32_t product = ((argb >> shift) & 0xFF) * alpha + 128;
+        result |= ((product + (product >> 8)) >> 8) << shift;
+    }
+    return result;
+}
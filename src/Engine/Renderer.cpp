@@ -1,122 +1,46 @@
-#include <vector>
+#include <memory>
+#include <string>
 
 #include "Engine/Renderer.hpp"
-
-#include "Common/Types.hpp"
-#include "Common/Constants.hpp"
+#include "Engine/CpuRenderer.hpp"
+#include "Engine/SdlRenderer.hpp"
 
 namespace Engine
 {
-    /**
-     * @brief Creates an SDL renderer for the specified window and configures logical presentation.
-     *
-     * Initializes the internal SDL_Renderer associated with the provided SDL_Window and sets
-     * the renderer's logical presentation to the engine's SCREEN_WIDTH and SCREEN_HEIGHT
-     * using letterbox scaling.
-     *
-     * @param window SDL_Window to create the renderer for; may be nullptr.
-     *
-     * If renderer creation fails, an error is logged and the internal renderer remains unset. */
-    Renderer::Renderer(SDL_Window *window)
+    std::unique_ptr<Renderer> Renderer::create(RendererBackend backend, SDL_Window *window, Utils::JobSystem *jobs)
     {
-        m_sdlRenderer = SDL_CreateRenderer(window, NULL);
-
-        if (!m_sdlRenderer)
-        {
-            SDL_LogError(1, "Failed to create renderer");
-            return;
-        }
-
-        SDL_SetRenderLogicalPresentation(m_sdlRenderer, Common::SCREEN_WIDTH, Common::SCREEN_HEIGHT, SDL_LOGICAL_PRESENTATION_LETTERBOX);
+        if (backend == RendererBackend::RENDERER_CPU)
+            return std::make_unique<CpuRenderer>(window, jobs);
+        return std::make_unique<SdlRenderer>(window);
     }
 
-    /**
-     * @brief Prepares the renderer for a new frame by clearing the screen and drawing the game-area background.
-     *
-     * If the SDL renderer is not initialized, the call has no effect. Otherwise the render target is cleared to
-     * black and the logical game area is filled with a dark gray rectangle.
-     */
-    void Renderer::beginFrame()
+    bool Renderer::loadTexture(Common::TextureID id, const std::string &path)
     {
-        if (!m_sdlRenderer)
-            return;
-        SDL_SetRenderDrawColor(m_sdlRenderer, 0, 0, 0, 255);
-        SDL_RenderClear(m_sdlRenderer);
-
-        SDL_FRect gameArea = {0, 0, (float)Common::SCREEN_WIDTH, (float)Common::SCREEN_HEIGHT};
-        SDL_SetRenderDrawColor(m_sdlRenderer, 30, 30, 30, 255);
-        SDL_RenderFillRect(m_sdlRenderer, &gameArea);
-    }
-
-    /**
-     * @brief Releases renderer-owned GPU resources and associated cached textures.
-     *
-     * Destroys all SDL textures stored in the texture cache, clears the cache,
-     * and destroys the underlying SDL_Renderer if one was created.
-     */
-    Renderer::~Renderer()
-    {
-        for (auto &[id, texture] : m_textureCache)
-        {
-            SDL_DestroyTexture(texture);
-        }
-        m_textureCache.clear();
-        if (m_sdlRenderer)
+        SDL_Surface *loaded = SDL_LoadBMP(path.c_str());
+        if (!loaded)
         {
-            SDL_DestroyRenderer(m_sdlRenderer);
+            SDL_LogError(1, "Failed to load texture %s: %s", path.c_str(), SDL_GetError());
+            return false;
         }
+        const bool added = addTexture(id, loaded);
+        SDL_DestroySurface(loaded);
+        return added;
     }
 
-    /**
-     * @brief Renders a sequence of render commands to the SDL renderer.
-     *
-     * For each command, uses a cached SDL_Texture when available; otherwise draws a filled rectangle
-     * at the command's destination. The destination rectangle is defined by the command's
-     * `x`, `y`, `width`, and `height`.
-     *
-     * When no cached texture is found, the rectangle color is chosen by texture ID:
-     * - `Common::TextureID::TEX_PLAYER` → red (255,0,0,255)
-     * - otherwise → cyan (0,255,255,255)
-     *
-     * @param commands List of render commands specifying texture IDs and destination rectangles.
-     */
-    void Renderer::drawCommands(const std::vector<Common::RenderCommand> &commands)
+    uint32_t Renderer::getFallbackColor(Common::TextureID id)
     {
-        if (!m_sdlRenderer)
-            return;
-        for (const auto &cmd : commands)
+        switch (id)
         {
-            SDL_FRect dest = {cmd.x, cmd.y, cmd.width, cmd.height};
-            auto it = m_textureCache.find(cmd.textureID);
-            if (it != m_textureCache.end())
-            {
-                SDL_RenderTexture(m_sdlRenderer, it->second, NULL, &dest);
-            }
-            else
-            {
-                if (cmd.textureID == Common::TextureID::TEX_PLAYER)
-                {
-                    SDL_SetRenderDrawColor(m_sdlRenderer, 255, 0, 0, 255);
-                }
-                else
-                {
-                    SDL_SetRenderDrawColor(m_sdlRenderer, 0, 255, 255, 255);
-                }
-
-                SDL_RenderFillRect(m_sdlRenderer, &dest);
-            }
+        case Common::TextureID::TEX_PLAYER:
+            return 0xFF0000FF;
+        case Common::TextureID::TEX_WALL:
+            return 0x5A6478FF;
+        case Common::TextureID::TEX_FLOOR:
+            return 0x8C643CFF;
+        case Common::TextureID::TEX_PROJECTILE:
+            return 0xFFDC00FF;
+        default:
+            return 0x00FFFFFF;
         }
     }
-
-    /**
-     * @brief Presents the current rendered frame to the display.
-     *
-     * If the internal SDL_Renderer is not initialized, this call does nothing.
-     */
-    void Renderer::endFrame()
-    {
-        if (!m_sdlRenderer)
-            return;
-        SDL_RenderPresent(m_sdlRenderer);
-    }
-}
\ No newline at end of file
+} // namespace Engine
@@ -0,0 +1,449 @@
+#include <algorithm>
+#include <string>
+#include <vector>
+
+#include "Engine/SdlRenderer.hpp"
+
+#include "Common/Types.hpp"
+#include "Common/Constants.hpp"
+
+namespace
+{
+    SDL_FColor toFColor(uint32_t rgba)
+    {
+        constexpr float BYTE_TO_UNIT = 1.0f / 255.0f;
+        return {(float)(rgba >> 24) * BYTE_TO_UNIT, (float)((rgba >> 16) & 0xFF) * BYTE_TO_UNIT, (float)((rgba >> 8) & 0xFF) * BYTE_TO_UNIT,
+                (float)(rgba & 0xFF) * BYTE_TO_UNIT};
+    }
+}
+
+namespace Engine
+{
+    /**
+     * @brief Creates an SDL renderer for the specified window and configures logical presentation.
+     *
+     * Initializes the internal SDL_Renderer associated with the provided SDL_Window and sets
+     * the renderer's logical presentation to the engine's SCREEN_WIDTH and SCREEN_HEIGHT
+     * using letterbox scaling.
+     *
+     * @param window SDL_Window to create the renderer for; may be nullptr.
+     *
+     * If renderer creation fails, an error is logged and the internal renderer remains unset. */
+    SdlRenderer::SdlRenderer(SDL_Window *window)
+    {
+        m_sdlRenderer = SDL_CreateRenderer(window, NULL);
+
+        if (!m_sdlRenderer)
+        {
+            SDL_LogError(1, "Failed to create renderer");
+            return;
+        }
+
+        SDL_SetRenderLogicalPresentation(m_sdlRenderer, Common::SCREEN_WIDTH, Common::SCREEN_HEIGHT, SDL_LOGICAL_PRESENTATION_LETTERBOX);
+    }
+
+    /**
+     * @brief Prepares the renderer for a new frame by clearing the screen.
+     *
+     * Resets the per-frame render stats. If the SDL renderer is not initialized, nothing is drawn. Otherwise the
+     * render target is cleared to black. The dark gray game-area background is left to drawStaticChunks(), which
+     * skips it when the cached chunks already cover the view, or to drawCommands() if no static layer is drawn.
+     */
+    void SdlRenderer::beginFrame()
+    {
+        m_stats = {};
+        m_frameCounter++;
+        m_backgroundDrawn = false;
+        if (!m_sdlRenderer)
+            return;
+        SDL_SetRenderDrawColor(m_sdlRenderer, 0, 0, 0, 255);
+        SDL_RenderClear(m_sdlRenderer);
+    }
+
+    /**
+     * @brief Fills the logical game area with the background color.
+     */
+    void SdlRenderer::drawBackground()
+    {
+        m_backgroundDrawn = true;
+        SDL_FRect gameArea = {0, 0, (float)Common::SCREEN_WIDTH, (float)Common::SCREEN_HEIGHT};
+        SDL_SetRenderDrawColor(m_sdlRenderer, BACKGROUND_GRAY, BACKGROUND_GRAY, BACKGROUND_GRAY, 255);
+        SDL_RenderFillRect(m_sdlRenderer, &gameArea);
+        m_stats.drawCalls++;
+    }
+
+    /**
+     * @brief Blits one cached texture per visible chunk, building missing or stale ones first.
+     *
+     * Chunk textures are opaque and include the background, so the full-screen background fill is
+     * skipped when the chunks cover the whole view. Chunks that cannot be cached (no free slot this
+     * frame, texture creation failed) are drawn tile by tile instead.
+     */
+    void SdlRenderer::drawStaticChunks(const Utils::FrameVector<Common::StaticChunkCommand> &chunks)
+    {
+        if (!m_sdlRenderer)
+            return;
+
+        const float chunkSize = (float)Common::CHUNK_PIXELS;
+        float coveredArea = 0.0f;
+        for (const Common::StaticChunkCommand &chunk : chunks)
+        {
+            const float width = std::min(chunk.x + chunkSize, (float)Common::SCREEN_WIDTH) - std::max(chunk.x, 0.0f);
+            const float height = std::min(chunk.y + chunkSize, (float)Common::SCREEN_HEIGHT) - std::max(chunk.y, 0.0f);
+            if (width > 0.0f && height > 0.0f)
+                coveredArea += width * height;
+        }
+        if (coveredArea < (float)Common::SCREEN_WIDTH * Common::SCREEN_HEIGHT)
+            drawBackground();
+        m_backgroundDrawn = true;
+
+        for (const Common::StaticChunkCommand &chunk : chunks)
+        {
+            const SDL_FRect destination = {chunk.x, chunk.y, chunkSize, chunkSize};
+            if (SDL_Texture *texture = acquireChunkTexture(chunk))
+            {
+                SDL_RenderTexture(m_sdlRenderer, texture, nullptr, &destination);
+                m_stats.drawCalls++;
+                m_stats.staticChunksDrawn++;
+                continue;
+            }
+
+            SDL_SetRenderDrawColor(m_sdlRenderer, BACKGROUND_GRAY, BACKGROUND_GRAY, BACKGROUND_GRAY, 255);
+            SDL_RenderFillRect(m_sdlRenderer, &destination);
+            m_stats.drawCalls++;
+            if (!m_staticSource)
+                continue;
+            m_chunkCommands.clear();
+            m_staticSource(chunk.chunkX, chunk.chunkY, m_chunkCommands);
+            for (Common::RenderCommand &command : m_chunkCommands)
+            {
+                command.x += chunk.x;
+                command.y += chunk.y;
+            }
+            submitCommands(m_chunkCommands.data(), m_chunkCommands.size());
+        }
+    }
+
+    /**
+     * @brief Finds the chunk's cache slot, or claims the least recently used slot not drawn this frame.
+     *
+     * A slot whose version differs from the command's is re-rendered in place: the chunk's commands
+     * are drawn into the slot's render-target texture over the background color.
+     */
+    SDL_Texture *SdlRenderer::acquireChunkTexture(const Common::StaticChunkCommand &chunk)
+    {
+        CachedChunk *slot = nullptr;
+        for (CachedChunk &cached : m_chunkCache)
+        {
+            if (cached.texture && cached.chunkX == chunk.chunkX && cached.chunkY == chunk.chunkY)
+            {
+                slot = &cached;
+                break;
+            }
+        }
+
+        if (slot && slot->version == chunk.version)
+        {
+            slot->lastUsedFrame = m_frameCounter;
+            return slot->texture;
+        }
+
+        if (!m_staticSource)
+            return nullptr;
+
+        if (!slot)
+        {
+            for (CachedChunk &cached : m_chunkCache)
+            {
+                if (!cached.texture)
+                {
+                    slot = &cached;
+                    break;
+                }
+                if (cached.lastUsedFrame != m_frameCounter && (!slot || cached.lastUsedFrame < slot->lastUsedFrame))
+                    slot = &cached;
+            }
+            if (!slot)
+                return nullptr;
+        }
+
+        if (!slot->texture)
+        {
+            slot->texture = SDL_CreateTexture(m_sdlRenderer, SDL_PIXELFORMAT_RGBA32, SDL_TEXTUREACCESS_TARGET,
+                                              Common::CHUNK_PIXELS, Common::CHUNK_PIXELS);
+            if (!slot->texture)
+            {
+                SDL_LogError(1, "Failed to create chunk texture: %s", SDL_GetError());
+                return nullptr;
+            }
+            SDL_SetTextureScaleMode(slot->texture, SDL_SCALEMODE_NEAREST);
+            SDL_SetTextureBlendMode(slot->texture, SDL_BLENDMODE_NONE);
+        }
+
+        SDL_Texture *previousTarget = SDL_GetRenderTarget(m_sdlRenderer);
+        SDL_SetRenderTarget(m_sdlRenderer, slot->texture);
+        SDL_SetRenderDrawColor(m_sdlRenderer, BACKGROUND_GRAY, BACKGROUND_GRAY, BACKGROUND_GRAY, 255);
+        SDL_RenderClear(m_sdlRenderer);
+
+        m_chunkCommands.clear();
+        m_staticSource(chunk.chunkX, chunk.chunkY, m_chunkCommands);
+        submitCommands(m_chunkCommands.data(), m_chunkCommands.size());
+        SDL_SetRenderTarget(m_sdlRenderer, previousTarget);
+
+        slot->chunkX = chunk.chunkX;
+        slot->chunkY = chunk.chunkY;
+        slot->version = chunk.version;
+        slot->lastUsedFrame = m_frameCounter;
+        m_stats.staticChunksRebuilt++;
+        return slot->texture;
+    }
+
+    void SdlRenderer::invalidateStaticCache()
+    {
+        for (CachedChunk &cached : m_chunkCache)
+        {
+            if (cached.texture)
+                SDL_DestroyTexture(cached.texture);
+            cached = {};
+        }
+    }
+
+    /**
+     * @brief Releases renderer-owned GPU resources and associated cached textures.
+     *
+     * Destroys all atlas page textures, clears the texture cache,
+     * and destroys the underlying SDL_Renderer if one was created.
+     */
+    SdlRenderer::~SdlRenderer()
+    {
+        invalidateStaticCache();
+        for (SDL_Texture *page : m_atlasPages)
+        {
+            SDL_DestroyTexture(page);
+        }
+        m_atlasPages.clear();
+        m_textureCache = {};
+        if (m_sdlRenderer)
+        {
+            SDL_DestroyRenderer(m_sdlRenderer);
+        }
+    }
+
+    /**
+     * @brief Converts a sprite to RGBA and stages it in the atlas builder.
+     *
+     * Nothing is uploaded until buildAtlas() is called, so all sprites can share as few textures as possible.
+     */
+    bool SdlRenderer::addTexture(Common::TextureID id, SDL_Surface *surface)
+    {
+        if ((int)id < 0 || id >= Common::TextureID::TEX_COUNT)
+            return false;
+
+        SDL_Surface *converted = SDL_ConvertSurface(surface, SDL_PIXELFORMAT_RGBA32);
+        if (!converted)
+            return false;
+
+        m_atlasBuilder.add(id, converted);
+        return true;
+    }
+
+    /**
+     * @brief Packs the staged sprites into new atlas pages and points their cache slots at them.
+     *
+     * Cached chunk textures were drawn with the old sprites, so they are dropped. If the renderer
+     * is not initialized, staged sprites are kept and nothing is packed.
+     */
+    int SdlRenderer::buildAtlas()
+    {
+        if (!m_sdlRenderer || m_atlasBuilder.empty())
+            return 0;
+        invalidateStaticCache();
+        return m_atlasBuilder.build(m_sdlRenderer, m_atlasPages, m_textureCache);
+    }
+
+    /**
+     * @brief Looks up the atlas region of a texture ID in the flat cache.
+     *
+     * @return const AtlasRegion* The region, or nullptr if the ID is out of range or has no loaded texture.
+     */
+    const AtlasRegion *SdlRenderer::findRegion(Common::TextureID id) const
+    {
+        if ((int)id < 0 || id >= Common::TextureID::TEX_COUNT)
+            return nullptr;
+        const AtlasRegion &region = m_textureCache[(size_t)id];
+        return region.texture ? &region : nullptr;
+    }
+
+    /**
+     * @brief Renders a sequence of render commands to the SDL renderer in as few draw calls as possible.
+     *
+     * Commands are ordered by `layer`, then by submission order (the same order as CpuRenderer),
+     * and each run of consecutive commands sharing an atlas page is turned into quads and submitted
+     * with a single SDL_RenderGeometry call. Each command's UV rectangle is mapped into its sprite's atlas region.
+     *
+     * Commands without a cached texture share one untextured batch and are colored with getFallbackColor().
+     *
+     * @param commands List of render commands specifying texture IDs and destination rectangles.
+     */
+    void SdlRenderer::drawCommands(const Utils::FrameVector<Common::RenderCommand> &commands)
+    {
+        m_stats.commandsReceived += commands.size();
+        if (!m_sdlRenderer)
+            return;
+        if (!m_backgroundDrawn)
+            drawBackground();
+        submitCommands(commands.data(), commands.size());
+    }
+
+    /**
+     * @brief Sorts and batches `count` commands into the current render target (see drawCommands()).
+     */
+    void SdlRenderer::submitCommands(const Common::RenderCommand *commands, size_t count)
+    {
+        if (count == 0)
+            return;
+
+        // Sort key: | layer (32) | command index (32) |
+        m_sortKeys.clear();
+        m_sortKeys.reserve(count);
+        for (size_t i = 0; i < count; i++)
+        {
+            const Uint64 layer = (Uint64)(Uint32)(commands[i].layer + 0x80000000u);
+            m_sortKeys.push_back((layer << 32) | (Uint64)i);
+        }
+        std::sort(m_sortKeys.begin(), m_sortKeys.end());
+
+        const SDL_FColor white = {1.0f, 1.0f, 1.0f, 1.0f};
+
+        SDL_Texture *batchTexture = nullptr;
+
+        for (Uint64 key : m_sortKeys)
+        {
+            const Common::RenderCommand &cmd = commands[(size_t)(key & 0xFFFFFFFF)];
+            const AtlasRegion *region = findRegion(cmd.textureID);
+            SDL_Texture *texture = region ? region->texture : nullptr;
+            if (texture != batchTexture)
+            {
+                flushBatch(batchTexture);
+                batchTexture = texture;
+            }
+
+            if (region)
+                appendQuad(cmd, white, region);
+            else
+                appendQuad(cmd, toFColor(getFallbackColor(cmd.textureID)), nullptr);
+        }
+        flushBatch(batchTexture);
+    }
+
+    /**
+     * @brief Builds four vertices per particle into the batch buffer and submits them with flushBatch().
+     *
+     * Untextured geometry is blended with the renderer's draw blend mode, which is switched to
+     * alpha blending for the submission and restored afterwards.
+     */
+    void SdlRenderer::drawParticles(const Utils::FrameVector<Common::ParticleInstance> &particles)
+    {
+        if (!m_sdlRenderer || particles.empty())
+            return;
+
+        m_vertices.clear();
+        m_vertices.reserve(particles.size() * 4);
+        for (const Common::ParticleInstance &particle : particles)
+        {
+            const SDL_FColor color = toFColor(particle.color);
+            const float x0 = particle.x, y0 = particle.y;
+            const float x1 = particle.x + particle.size, y1 = particle.y + particle.size;
+            m_vertices.push_back({{x0, y0}, color, {0.0f, 0.0f}});
+            m_vertices.push_back({{x1, y0}, color, {0.0f, 0.0f}});
+            m_vertices.push_back({{x1, y1}, color, {0.0f, 0.0f}});
+            m_vertices.push_back({{x0, y1}, color, {0.0f, 0.0f}});
+        }
+
+        SDL_BlendMode previousMode = SDL_BLENDMODE_NONE;
+        SDL_GetRenderDrawBlendMode(m_sdlRenderer, &previousMode);
+        SDL_SetRenderDrawBlendMode(m_sdlRenderer, SDL_BLENDMODE_BLEND);
+        flushBatch(nullptr);
+        SDL_SetRenderDrawBlendMode(m_sdlRenderer, previousMode);
+        m_stats.particlesDrawn += particles.size();
+    }
+
+    /**
+     * @brief Appends the destination rectangle of a command as four vertices to the pending batch.
+     *
+     * @param cmd Command providing the destination rectangle and sprite-relative UV rectangle.
+     * @param color Vertex color; white for textured quads.
+     * @param region Atlas region of the command's sprite, or nullptr for an untextured quad.
+     */
+    void SdlRenderer::appendQuad(const Common::RenderCommand &cmd, const SDL_FColor &color, const AtlasRegion *region)
+    {
+        const float x0 = cmd.x, y0 = cmd.y;
+        const float x1 = cmd.x + cmd.width, y1 = cmd.y + cmd.height;
+
+        float u0 = 0.0f, v0 = 0.0f, u1 = 0.0f, v1 = 0.0f;
+        if (region)
+        {
+            const float regionW = region->u1 - region->u0;
+            const float regionH = region->v1 - region->v0;
+            u0 = region->u0 + cmd.u0 * regionW;
+            v0 = region->v0 + cmd.v0 * regionH;
+            u1 = region->u0 + cmd.u1 * regionW;
+            v1 = region->v0 + cmd.v1 * regionH;
+        }
+
+        m_vertices.push_back({{x0, y0}, color, {u0, v0}});
+        m_vertices.push_back({{x1, y0}, color, {u1, v0}});
+        m_vertices.push_back({{x1, y1}, color, {u1, v1}});
+        m_vertices.push_back({{x0, y1}, color, {u0, v1}});
+    }
+
+    /**
+     * @brief Submits the pending quads with one SDL_RenderGeometry call and empties the vertex buffer.
+     *
+     * The index buffer only depends on the quad count, so it is grown on demand and reused as-is.
+     *
+     * @param texture Texture shared by every quad in the batch, or nullptr for colored rectangles.
+     */
+    void SdlRenderer::flushBatch(SDL_Texture *texture)
+    {
+        if (m_vertices.empty())
+            return;
+
+        const size_t quadCount = m_vertices.size() / 4;
+        for (size_t quad = m_indices.size() / 6; quad < quadCount; quad++)
+        {
+            const int base = (int)(quad * 4);
+            m_indices.insert(m_indices.end(), {base, base + 1, base + 2, base + 2, base + 3, base});
+        }
+
+        SDL_RenderGeometry(m_sdlRenderer, texture, m_vertices.data(), (int)m_vertices.size(), m_indices.data(), (int)(quadCount * 6));
+        m_stats.drawCalls++;
+        m_vertices.clear();
+    }
+
+    /**
+     * @brief Presents the current rendered frame to the display.
+     *
+     * If the internal SDL_Renderer is not initialized, this call does nothing.
+     */
+    void SdlRenderer::endFrame()
+    {
+        if (!m_sdlRenderer)
+            return;
+        if (!m_capturePath.empty())
+            saveCapture();
+        SDL_RenderPresent(m_sdlRenderer);
+    }
+
+    /**
+     * @brief Reads the finished frame back from the render target and writes it to the pending capture path.
+     */
+    void SdlRenderer::saveCapture()
+    {
+        SDL_Surface *frame = SDL_RenderReadPixels(m_sdlRenderer, nullptr);
+        if (!frame || !SDL_SaveBMP(frame, m_capturePath.c_str()))
+            SDL_LogError(1, "Failed to capture frame to %s: %s", m_capturePath.c_str(), SDL_GetError());
+        SDL_DestroySurface(frame);
+        m_capturePath.clear();
+    }
+}
\ No newline at end of file
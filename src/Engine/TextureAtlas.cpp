@@ -0,0 +1,226 @@
+#include <algorithm>
+#include <climits>
+#include <vector>
+
+#include "Engine/TextureAtlas.hpp"
+
+namespace Engine
+{
+    /**
+     * @brief Creates an empty packer whose skyline spans the whole page at height zero.
+     *
+     * @param width Page width in pixels.
+     * @param height Page height in pixels.
+     */
+    RectPacker::RectPacker(int width, int height)
+        : m_width(width), m_height(height)
+    {
+        m_skyline.push_back({0, 0, width});
+    }
+
+    /**
+     * @brief Computes the lowest y at which a rectangle starting at skyline node `index` would rest.
+     *
+     * @return int The resting y coordinate, or -1 if the rectangle would leave the page.
+     */
+    int RectPacker::fitAt(size_t index, int width, int height) const
+    {
+        const int x = m_skyline[index].x;
+        if (x + width > m_width)
+            return -1;
+
+        int y = 0;
+        int remaining = width;
+        for (size_t i = index; remaining > 0; i++)
+        {
+            if (i >= m_skyline.size())
+                return -1;
+            y = std::max(y, m_skyline[i].y);
+            if (y + height > m_height)
+                return -1;
+            remaining -= m_skyline[i].width;
+        }
+        return y;
+    }
+
+    /**
+     * @brief Places a rectangle at the position that keeps the skyline lowest, then updates the skyline.
+     *
+     * Candidates are compared by resulting top edge (y + height), ties broken by the narrowest node.
+     */
+    bool RectPacker::insert(int width, int height, int &outX, int &outY)
+    {
+        int bestTop = INT_MAX;
+        int bestWidth = INT_MAX;
+        size_t bestIndex = m_skyline.size();
+
+        for (size_t i = 0; i < m_skyline.size(); i++)
+        {
+            int y = fitAt(i, width, height);
+            if (y < 0)
+                continue;
+            if (y + height < bestTop || (y + height == bestTop && m_skyline[i].width < bestWidth))
+            {
+                bestTop = y + height;
+                bestWidth = m_skyline[i].width;
+                bestIndex = i;
+            }
+        }
+
+        if (bestIndex == m_skyline.size())
+            return false;
+
+        outX = m_skyline[bestIndex].x;
+        outY = bestTop - height;
+
+        // Raise the skyline over the placed rectangle and trim the nodes it now covers
+        m_skyline.insert(m_skyline.begin() + bestIndex, {outX, bestTop, width});
+        for (size_t i = bestIndex + 1; i < m_skyline.size();)
+        {
+            const int coveredEnd = m_skyline[i - 1].x + m_skyline[i - 1].width;
+            if (m_skyline[i].x >= coveredEnd)
+                break;
+
+            const int shrink = coveredEnd - m_skyline[i].x;
+            m_skyline[i].x += shrink;
+            m_skyline[i].width -= shrink;
+            if (m_skyline[i].width <= 0)
+                m_skyline.erase(m_skyline.begin() + i);
+            else
+                break;
+        }
+
+        // Merge neighbours that ended up at the same height
+        for (size_t i = 0; i + 1 < m_skyline.size();)
+        {
+            if (m_skyline[i].y == m_skyline[i + 1].y)
+            {
+                m_skyline[i].width += m_skyline[i + 1].width;
+                m_skyline.erase(m_skyline.begin() + i + 1);
+            }
+            else
+            {
+                i++;
+            }
+        }
+        return true;
+    }
+
+    /**
+     * @brief Releases any sprites that were staged but never built.
+     */
+    TextureAtlasBuilder::~TextureAtlasBuilder()
+    {
+        clear();
+    }
+
+    void TextureAtlasBuilder::add(Common::TextureID id, SDL_Surface *surface)
+    {
+        if (!surface)
+            return;
+        for (auto &staged : m_staged)
+        {
+            if (staged.id == id)
+            {
+                SDL_DestroySurface(staged.surface);
+                staged.surface = surface;
+                return;
+            }
+        }
+        m_staged.push_back({id, surface});
+    }
+
+    /**
+     * @brief Packs staged sprites tallest-first into ATLAS_PAGE_SIZE pages and uploads each page once.
+     *
+     * Sprites are placed with ATLAS_PADDING pixels of spacing; a new page is opened only when no
+     * existing page has room. Sprites larger than a page are skipped with an error.
+     */
+    int TextureAtlasBuilder::build(SDL_Renderer *renderer, std::vector<SDL_Texture *> &pages, AtlasRegionTable &regions)
+    {
+        std::sort(m_staged.begin(), m_staged.end(), [](const StagedSprite &a, const StagedSprite &b)
+                  { return a.surface->h != b.surface->h ? a.surface->h > b.surface->h : a.surface->w > b.surface->w; });
+
+        std::vector<RectPacker> packers;
+        std::vector<SDL_Surface *> pageSurfaces;
+        int packed = 0;
+
+        for (const auto &sprite : m_staged)
+        {
+            const int w = sprite.surface->w;
+            const int h = sprite.surface->h;
+            if (w + ATLAS_PADDING > ATLAS_PAGE_SIZE || h + ATLAS_PADDING > ATLAS_PAGE_SIZE)
+            {
+                SDL_LogError(1, "Sprite %d (%dx%d) does not fit in an atlas page", (int)sprite.id, w, h);
+                continue;
+            }
+
+            int x = 0, y = 0;
+            size_t page = 0;
+            while (page < packers.size() && !packers[page].insert(w + ATLAS_PADDING, h + ATLAS_PADDING, x, y))
+                page++;
+
+            if (page == packers.size())
+            {
+                SDL_Surface *pageSurface = SDL_CreateSurface(ATLAS_PAGE_SIZE, ATLAS_PAGE_SIZE, SDL_PIXELFORMAT_RGBA32);
+                if (!pageSurface)
+                {
+                    SDL_LogError(1, "Failed to create atlas page: %s", SDL_GetError());
+                    break;
+                }
+                SDL_FillSurfaceRect(pageSurface, NULL, 0);
+                pageSurfaces.push_back(pageSurface);
+                packers.emplace_back(ATLAS_PAGE_SIZE, ATLAS_PAGE_SIZE);
+                packers.back().insert(w + ATLAS_PADDING, h + ATLAS_PADDING, x, y);
+            }
+
+            SDL_Rect dest = {x, y, w, h};
+            SDL_SetSurfaceBlendMode(sprite.surface, SDL_BLENDMODE_NONE);
+            SDL_BlitSurface(sprite.surface, NULL, pageSurfaces[page], &dest);
+
+            AtlasRegion &region = regions[(size_t)sprite.id];
+            region.page = (int)(pages.size() + page);
+            region.u0 = (float)x / ATLAS_PAGE_SIZE;
+            region.v0 = (float)y / ATLAS_PAGE_SIZE;
+            region.u1 = (float)(x + w) / ATLAS_PAGE_SIZE;
+            region.v1 = (float)(y + h) / ATLAS_PAGE_SIZE;
+            packed++;
+        }
+
+        const size_t firstPage = pages.size();
+        for (SDL_Surface *pageSurface : pageSurfaces)
+        {
+            SDL_Texture *texture = SDL_CreateTextureFromSurface(renderer, pageSurface);
+            if (texture)
+            {
+                SDL_SetTextureScaleMode(texture, SDL_SCALEMODE_NEAREST);
+                SDL_SetTextureBlendMode(texture, SDL_BLENDMODE_BLEND);
+            }
+            else
+            {
+                SDL_LogError(1, "Failed to upload atlas page: %s", SDL_GetError());
+            }
+            pages.push_back(texture);
+            SDL_DestroySurface(pageSurface);
+        }
+
+        for (const auto &sprite : m_staged)
+        {
+            AtlasRegion &region = regions[(size_t)sprite.id];
+            if (region.page >= (int)firstPage)
+                region.texture = pages[region.page];
+        }
+
+        clear();
+        return packed;
+    }
+
+    void TextureAtlasBuilder::clear()
+    {
+        for (auto &staged : m_staged)
+        {
+            SDL_DestroySurface(staged.surface);
+        }
+        m_staged.clear();
+    }
+} // namespace Engine
@@ -1,3 +1,5 @@
+#include <cmath>
+#include <cstdio>
 #include <string>
 
 #include "Engine/WindowManager.hpp"
@@ -81,33 +83,24 @@ namespace Engine
     }
 
     /**
-     * @brief Updates the frame rate counter and refreshes the window title once per second.
+     * @brief Sets the window title to Common::WINDOW_TITLE_PREFIX followed by the average FPS, the
+     * 1% lows and the frame-time spread.
      *
-     * Increments the supplied frame counter and, when more than 1000 milliseconds have
-     * elapsed since lastFpsUpdate, sets the SDL window title to Common::WINDOW_TITLE_PREFIX
-     * followed by the current FPS value, resets the frame counter to zero, and updates
-     * lastFpsUpdate to the current time.
+     * The title is formatted into a fixed member buffer, so no allocation happens per refresh.
      *
-     * @param currentTime Current time in milliseconds.
-     * @param lastFpsUpdate Reference to the timestamp of the last title update; updated to currentTime when a title refresh occurs.
-     * @param fps Reference to the accumulated frame count; incremented on each call and reset to 0 after a title refresh.
+     * @param stats Rolling frame statistics to display.
      */
-    void WindowManager::fpsCounter(const Uint64 &currentTime, Uint64 &lastFpsUpdate, Uint64 &fps)
+    void WindowManager::showFrameStats(const Utils::FrameStats &stats)
     {
-        fps++;
-
-        if (currentTime > lastFpsUpdate + 1000)
-        {
-            SDL_Window *window = getSDLWindow();
+        SDL_Window *window = getSDLWindow();
 
-            if (!window)
-                return;
+        if (!window)
+            return;
 
-            lastFpsUpdate = currentTime;
-            std::string title = Common::WINDOW_TITLE_PREFIX + std::to_string(fps);
-            SDL_SetWindowTitle(window, title.c_str());
-            fps = 0;
-        }
+        std::snprintf(m_title, sizeof(m_title), "%s%.0f (1%% low %.0f) | %.2f ms [%.2f-%.2f, sd %.2f]",
+                      Common::WINDOW_TITLE_PREFIX, stats.averageFps, stats.onePercentLowFps,
+                      stats.averageMs, stats.minMs, stats.maxMs, std::sqrt(stats.varianceMs2));
+        SDL_SetWindowTitle(window, m_title);
     }
 
     /**
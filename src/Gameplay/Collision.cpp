@@ -0,0 +1,130 @@
+#include <cmath>
+
+#include "Gameplay/Collision.hpp"
+
+#include "Common/Constants.hpp"
+
+namespace
+{
+    constexpr float TILE = (float)Common::TILE_SIZE;
+
+    // First and last tile index covered by the span [start, start + length)
+    int firstCell(float start) { return (int)std::floor(start / TILE); }
+    int lastCell(float start, float length) { return (int)std::ceil((start + length) / TILE) - 1; }
+
+    /**
+     * @brief Returns whether any tile in column `column` between rows `rowBegin` and `rowEnd` is solid.
+     */
+    bool columnBlocked(const Gameplay::Tilemap &map, int column, int rowBegin, int rowEnd)
+    {
+        for (int row = rowBegin; row <= rowEnd; row++)
+        {
+            if (Gameplay::isSolid(map.getTile(column, row)))
+                return true;
+        }
+        return false;
+    }
+
+    /**
+     * @brief Returns whether any tile in row `row` between columns `columnBegin` and `columnEnd` is solid.
+     */
+    bool rowBlocked(const Gameplay::Tilemap &map, int row, int columnBegin, int columnEnd)
+    {
+        for (int column = columnBegin; column <= columnEnd; column++)
+        {
+            if (Gameplay::isSolid(map.getTile(column, row)))
+                return true;
+        }
+        return false;
+    }
+}
+
+/**
+ * @brief Sweeps the box along x, then y, against the cells between its leading edges and destination.
+ */
+Gameplay::CollisionContacts Gameplay::moveAndCollide(const Tilemap &map, AABB &box, float &velocityX, float &velocityY, float deltaTime)
+{
+    CollisionContacts contacts;
+
+    const float dx = velocityX * deltaTime;
+    if (dx != 0.0f)
+    {
+        const int rowBegin = firstCell(box.y);
+        const int rowEnd = lastCell(box.y, box.height);
+        bool blocked = false;
+
+        if (dx > 0.0f)
+        {
+            const int target = lastCell(box.x, box.width + dx);
+            for (int column = lastCell(box.x, box.width) + 1; column <= target; column++)
+            {
+                if (columnBlocked(map, column, rowBegin, rowEnd))
+                {
+                    box.x = column * TILE - box.width;
+                    contacts.wallRight = blocked = true;
+                    break;
+                }
+            }
+        }
+        else
+        {
+            const int target = firstCell(box.x + dx);
+            for (int column = firstCell(box.x) - 1; column >= target; column--)
+            {
+                if (columnBlocked(map, column, rowBegin, rowEnd))
+                {
+                    box.x = (column + 1) * TILE;
+                    contacts.wallLeft = blocked = true;
+                    break;
+                }
+            }
+        }
+
+        if (blocked)
+            velocityX = 0.0f;
+        else
+            box.x += dx;
+    }
+
+    const float dy = velocityY * deltaTime;
+    if (dy != 0.0f)
+    {
+        const int columnBegin = firstCell(box.x);
+        const int columnEnd = lastCell(box.x, box.width);
+        bool blocked = false;
+
+        if (dy > 0.0f)
+        {
+            const int target = lastCell(box.y, box.height + dy);
+            for (int row = lastCell(box.y, box.height) + 1; row <= target; row++)
+            {
+                if (rowBlocked(map, row, columnBegin, columnEnd))
+                {
+                    box.y = row * TILE - box.height;
+                    contacts.ground = blocked = true;
+                    break;
+                }
+            }
+        }
+        else
+        {
+            const int target = firstCell(box.y + dy);
+            for (int row = firstCell(box.y) - 1; row >= target; row--)
+            {
+                if (rowBlocked(map, row, columnBegin, columnEnd))
+                {
+                    box.y = (row + 1) * TILE;
+                    contacts.ceiling = blocked = true;
+                    break;
+                }
+            }
+        }
+
+        if (blocked)
+            velocityY = 0.0f;
+        else
+            box.y += dy;
+    }
+
+    return contacts;
+}
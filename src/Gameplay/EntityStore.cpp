@@ -0,0 +1,188 @@
+#include <vector>
+
+#include "Gameplay/EntityStore.hpp"
+#include "Gameplay/WorldSnapshot.hpp"
+
+/**
+ * @brief Appends an entity to every column and binds it to a free (or new) slot.
+ *
+ * @param entityKind Kind of entity, used by systems to pick their entities.
+ * @param x World x coordinate of the top-left corner.
+ * @param y World y coordinate of the top-left corner.
+ * @param w Width in pixels.
+ * @param h Height in pixels.
+ * @param textureID Sprite drawn for the entity.
+ * @return Gameplay::EntityHandle Handle to the new entity.
+ */
+Gameplay::EntityHandle Gameplay::EntityStore::create(EntityKind entityKind, float x, float y, float w, float h, Common::TextureID textureID)
+{
+    uint32_t slot;
+    if (!m_freeSlots.empty())
+    {
+        slot = m_freeSlots.back();
+        m_freeSlots.pop_back();
+    }
+    else
+    {
+        slot = (uint32_t)m_slotToDense.size();
+        m_slotToDense.push_back(0);
+        m_slotGeneration.push_back(0);
+    }
+
+    const uint32_t dense = (uint32_t)size();
+    m_slotToDense[slot] = dense;
+    m_denseToSlot.push_back(slot);
+
+    posX.push_back(x);
+    posY.push_back(y);
+    prevX.push_back(x);
+    prevY.push_back(y);
+    velX.push_back(0.0f);
+    velY.push_back(0.0f);
+    width.push_back(w);
+    height.push_back(h);
+    lifetime.push_back(0.0f);
+    texture.push_back(textureID);
+    kind.push_back(entityKind);
+    flags.push_back(0);
+
+    return {slot, m_slotGeneration[slot]};
+}
+
+void Gameplay::EntityStore::destroy(EntityHandle handle)
+{
+    const size_t dense = indexOf(handle);
+    if (dense != NOT_FOUND)
+        destroyAt(dense);
+}
+
+/**
+ * @brief Swap-and-pop removal: the last entity takes over `denseIndex` and its slot is repointed.
+ *
+ * The removed entity's slot generation is bumped so outstanding handles to it become stale.
+ */
+void Gameplay::EntityStore::destroyAt(size_t denseIndex)
+{
+    const size_t last = size() - 1;
+    const uint32_t slot = m_denseToSlot[denseIndex];
+
+    if (denseIndex != last)
+    {
+        posX[denseIndex] = posX[last];
+        posY[denseIndex] = posY[last];
+        prevX[denseIndex] = prevX[last];
+        prevY[denseIndex] = prevY[last];
+        velX[denseIndex] = velX[last];
+        velY[denseIndex] = velY[last];
+        width[denseIndex] = width[last];
+        height[denseIndex] = height[last];
+        lifetime[denseIndex] = lifetime[last];
+        texture[denseIndex] = texture[last];
+        kind[denseIndex] = kind[last];
+        flags[denseIndex] = flags[last];
+
+        const uint32_t movedSlot = m_denseToSlot[last];
+        m_denseToSlot[denseIndex] = movedSlot;
+        m_slotToDense[movedSlot] = (uint32_t)denseIndex;
+    }
+
+    posX.pop_back();
+    posY.pop_back();
+    prevX.pop_back();
+    prevY.pop_back();
+    velX.pop_back();
+    velY.pop_back();
+    width.pop_back();
+    height.pop_back();
+    lifetime.pop_back();
+    texture.pop_back();
+    kind.pop_back();
+    flags.pop_back();
+    m_denseToSlot.pop_back();
+
+    m_slotGeneration[slot]++;
+    m_freeSlots.push_back(slot);
+}
+
+bool Gameplay::EntityStore::isAlive(EntityHandle handle) const
+{
+    return handle.index < m_slotGeneration.size() && m_slotGeneration[handle.index] == handle.generation;
+}
+
+size_t Gameplay::EntityStore::indexOf(EntityHandle handle) const
+{
+    if (!isAlive(handle))
+        return NOT_FOUND;
+    return m_slotToDense[handle.index];
+}
+
+/**
+ * @brief Reserves room in every column so spawning up to `capacity` entities does not reallocate.
+ */
+void Gameplay::EntityStore::reserve(size_t capacity)
+{
+    posX.reserve(capacity);
+    posY.reserve(capacity);
+    prevX.reserve(capacity);
+    prevY.reserve(capacity);
+    velX.reserve(capacity);
+    velY.reserve(capacity);
+    width.reserve(capacity);
+    height.reserve(capacity);
+    lifetime.reserve(capacity);
+    texture.reserve(capacity);
+    kind.reserve(capacity);
+    flags.reserve(capacity);
+    m_denseToSlot.reserve(capacity);
+}
+
+/**
+ * @brief Writes the entity, slot and free-slot counts, then one padded column per component and table.
+ *
+ * prevX/prevY are left out: they only serve render interpolation and every step overwrites them
+ * first, so saving them would nearly double the bytes that change per step.
+ */
+void Gameplay::EntityStore::save(WorldSnapshot &out) const
+{
+    out.write((uint32_t)size());
+    out.write((uint32_t)m_slotToDense.size());
+    out.write((uint32_t)m_freeSlots.size());
+    out.alignToBlock();
+
+    out.writeColumn(posX);
+    out.writeColumn(posY);
+    out.writeColumn(velX);
+    out.writeColumn(velY);
+    out.writeColumn(width);
+    out.writeColumn(height);
+    out.writeColumn(lifetime);
+    out.writeColumn(texture);
+    out.writeColumn(kind);
+    out.writeColumn(flags);
+    out.writeColumn(m_denseToSlot);
+    out.writeColumn(m_slotToDense);
+    out.writeColumn(m_slotGeneration);
+    out.writeColumn(m_freeSlots);
+}
+
+bool Gameplay::EntityStore::load(SnapshotReader &in)
+{
+    uint32_t count = 0, slots = 0, freeSlots = 0;
+    if (!in.read(count) || !in.read(slots) || !in.read(freeSlots) || !in.alignToBlock())
+        return false;
+
+    const bool loaded = in.readColumn(posX, count) && in.readColumn(posY, count) &&
+                        in.readColumn(velX, count) && in.readColumn(velY, count) &&
+                        in.readColumn(width, count) && in.readColumn(height, count) &&
+                        in.readColumn(lifetime, count) && in.readColumn(texture, count) &&
+                        in.readColumn(kind, count) && in.readColumn(flags, count) &&
+                        in.readColumn(m_denseToSlot, count) && in.readColumn(m_slotToDense, slots) &&
+                        in.readColumn(m_slotGeneration, slots) && in.readColumn(m_freeSlots, freeSlots);
+    if (!loaded)
+        return false;
+
+    // Entities restart at rest for render interpolation
+    prevX = posX;
+    prevY = posY;
+    return true;
+}
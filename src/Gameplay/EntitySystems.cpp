@@ -0,0 +1,220 @@
+#include <algorithm>
+#include <vector>
+
+#include "Gameplay/EntitySystems.hpp"
+#include "Gameplay/Collision.hpp"
+#include "Gameplay/MovementKernel.hpp"
+#include "Gameplay/MovementProfile.hpp"
+
+#include "Common/Constants.hpp"
+
+void Gameplay::beginStep(EntityStore &entities)
+{
+    std::copy(entities.posX.begin(), entities.posX.end(), entities.prevX.begin());
+    std::copy(entities.posY.begin(), entities.posY.end(), entities.prevY.begin());
+}
+
+/**
+ * @brief Picks each enemy's direction (and jumps) from the flow field, runs the movement rules as
+ * vectorized batches, then collides each enemy with the tile grid.
+ *
+ * Enemies accelerate towards their facing direction with the same rules as the player, using the
+ * constants of EnemyProfile. The walking direction lives in the ENTITY_FACING_LEFT flag: grounded
+ * enemies on a path take it from the field, which also tells them when to jump, and every enemy
+ * flips it on a wall contact. An enemy on the target tile stands still.
+ *
+ * @param entities Entity columns; only ENTITY_ENEMY entries are touched.
+ * @param map Tile grid to collide against.
+ * @param deltaTime Time step in seconds.
+ * @param scratch Gather buffers reused across steps.
+ * @param flow Field toward the player; nullptr leaves every enemy patrolling.
+ * @param jobs Optional worker pool to spread the batches over.
+ */
+void Gameplay::updateEnemies(EntityStore &entities, const Tilemap &map, float deltaTime, SystemScratch &scratch, const FlowField *flow,
+                             Utils::JobSystem *jobs)
+{
+    static constexpr MovementParams ENEMY_MOVEMENT = toMovementParams<EnemyProfile>();
+
+    scratch.indices.clear();
+    scratch.moveDir.clear();
+    scratch.velX.clear();
+    scratch.velY.clear();
+
+    const size_t count = entities.size();
+    for (size_t i = 0; i < count; i++)
+    {
+        if (entities.kind[i] != EntityKind::ENTITY_ENEMY)
+            continue;
+
+        float moveDir = (entities.flags[i] & ENTITY_FACING_LEFT) ? -1.0f : 1.0f;
+        float velY = entities.velY[i];
+        if (flow && (entities.flags[i] & ENTITY_ON_GROUND))
+        {
+            // Feet: bottom center, just above the ground tile
+            const FlowMove move = flow->getMove(entities.posX[i] + entities.width[i] * 0.5f, entities.posY[i] + entities.height[i] - 1.0f);
+            if (move == FlowMove::FLOW_ARRIVED)
+                moveDir = 0.0f;
+            else if (move == FlowMove::FLOW_LEFT || move == FlowMove::FLOW_JUMP_LEFT)
+                moveDir = -1.0f;
+            else if (move == FlowMove::FLOW_RIGHT || move == FlowMove::FLOW_JUMP_RIGHT)
+                moveDir = 1.0f;
+            if (move == FlowMove::FLOW_JUMP_LEFT || move == FlowMove::FLOW_JUMP_RIGHT)
+                velY = EnemyProfile::jumpForce;
+            if (moveDir != 0.0f)
+                entities.flags[i] = (uint8_t)((entities.flags[i] & ~ENTITY_FACING_LEFT) | (moveDir < 0.0f ? ENTITY_FACING_LEFT : 0));
+        }
+
+        scratch.indices.push_back((uint32_t)i);
+        scratch.moveDir.push_back(moveDir);
+        scratch.velX.push_back(entities.velX[i]);
+        scratch.velY.push_back(velY);
+    }
+
+    auto updateRange = [&](size_t begin, size_t end)
+    {
+        updateVelocities(Utils::detectSimdLevel(), ENEMY_MOVEMENT, scratch.moveDir.data() + begin, scratch.velX.data() + begin,
+                         scratch.velY.data() + begin, end - begin, deltaTime);
+
+        for (size_t n = begin; n < end; n++)
+        {
+            const size_t i = scratch.indices[n];
+            entities.velX[i] = scratch.velX[n];
+            entities.velY[i] = scratch.velY[n];
+
+            AABB box = {entities.posX[i], entities.posY[i], entities.width[i], entities.height[i]};
+            CollisionContacts contacts = moveAndCollide(map, box, entities.velX[i], entities.velY[i], deltaTime);
+            entities.posX[i] = box.x;
+            entities.posY[i] = box.y;
+
+            uint8_t flags = entities.flags[i] & ~ENTITY_ON_GROUND;
+            if (contacts.ground)
+                flags |= ENTITY_ON_GROUND;
+            if (contacts.wallLeft || contacts.wallRight)
+                flags ^= ENTITY_FACING_LEFT;
+            entities.flags[i] = flags;
+        }
+    };
+
+    if (jobs)
+        jobs->parallelFor(scratch.indices.size(), ENTITY_JOB_GRAIN, updateRange);
+    else
+        updateRange(0, scratch.indices.size());
+}
+
+void Gameplay::updateProjectiles(EntityStore &entities, const Tilemap &map, float deltaTime, Utils::JobSystem *jobs)
+{
+    moveProjectiles(entities, map, deltaTime, jobs);
+    removeSpentProjectiles(entities);
+}
+
+/**
+ * @brief Advances projectiles and marks spent ones by zeroing their lifetime.
+ *
+ * @param entities Entity columns; only ENTITY_PROJECTILE entries are touched.
+ * @param map Tile grid to collide against.
+ * @param deltaTime Time step in seconds.
+ * @param jobs Optional worker pool to spread the entity ranges over.
+ */
+void Gameplay::moveProjectiles(EntityStore &entities, const Tilemap &map, float deltaTime, Utils::JobSystem *jobs)
+{
+    auto moveRange = [&](size_t begin, size_t end)
+    {
+        for (size_t i = begin; i < end; i++)
+        {
+            if (entities.kind[i] != EntityKind::ENTITY_PROJECTILE)
+                continue;
+
+            entities.lifetime[i] -= deltaTime;
+
+            AABB box = {entities.posX[i], entities.posY[i], entities.width[i], entities.height[i]};
+            CollisionContacts contacts = moveAndCollide(map, box, entities.velX[i], entities.velY[i], deltaTime);
+            entities.posX[i] = box.x;
+            entities.posY[i] = box.y;
+
+            if (contacts.ground || contacts.ceiling || contacts.wallLeft || contacts.wallRight)
+                entities.lifetime[i] = 0.0f;
+        }
+    };
+
+    if (jobs)
+        jobs->parallelFor(entities.size(), ENTITY_JOB_GRAIN, moveRange);
+    else
+        moveRange(0, entities.size());
+}
+
+/**
+ * @brief Queries the hash with each live projectile's box and stops the projectile at the first enemy among the results.
+ */
+void Gameplay::hitEnemies(EntityStore &entities, const SpatialHash &hash, SystemScratch &scratch)
+{
+    for (size_t i = 0; i < entities.size(); i++)
+    {
+        if (entities.kind[i] != EntityKind::ENTITY_PROJECTILE || entities.lifetime[i] <= 0.0f)
+            continue;
+
+        const AABB box = {entities.posX[i], entities.posY[i], entities.width[i], entities.height[i]};
+        size_t found = hash.queryAABB(box, scratch.found.data(), scratch.found.size());
+        if (found > scratch.found.size())
+        {
+            scratch.found.resize(found);
+            found = hash.queryAABB(box, scratch.found.data(), scratch.found.size());
+        }
+        for (size_t k = 0; k < found; k++)
+        {
+            if (entities.kind[scratch.found[k]] == EntityKind::ENTITY_ENEMY)
+            {
+                entities.lifetime[i] = 0.0f;
+                break;
+            }
+        }
+    }
+}
+
+/**
+ * @brief Removes spent projectiles, iterating backwards so swap-and-pop removal never skips an entity.
+ */
+size_t Gameplay::removeSpentProjectiles(EntityStore &entities)
+{
+    size_t removed = 0;
+    for (size_t i = entities.size(); i-- > 0;)
+    {
+        if (entities.kind[i] == EntityKind::ENTITY_PROJECTILE && entities.lifetime[i] <= 0.0f)
+        {
+            entities.destroyAt(i);
+            removed++;
+        }
+    }
+    return removed;
+}
+
+void Gameplay::collectRenderCommands(const EntityStore &entities, const Camera &camera, float alpha, Utils::FrameVector<Common::RenderCommand> &out)
+{
+    collectRenderCommands(entities, camera, alpha, 0, entities.size(), out);
+}
+
+/**
+ * @brief Interpolates each entity in [begin, end) between its previous and current position and culls it against the camera.
+ */
+void Gameplay::collectRenderCommands(const EntityStore &entities, const Camera &camera, float alpha, size_t begin, size_t end,
+                                     Utils::FrameVector<Common::RenderCommand> &out)
+{
+    for (size_t i = begin; i < end; i++)
+    {
+        const float x = entities.prevX[i] + (entities.posX[i] - entities.prevX[i]) * alpha;
+        const float y = entities.prevY[i] + (entities.posY[i] - entities.prevY[i]) * alpha;
+        const float w = entities.width[i];
+        const float h = entities.height[i];
+
+        if (x + w < camera.x || y + h < camera.y || x > camera.x + camera.width || y > camera.y + camera.height)
+            continue;
+
+        Common::RenderCommand command;
+        command.x = x - camera.x;
+        command.y = y - camera.y;
+        command.width = w;
+        command.height = h;
+        command.textureID = entities.texture[i];
+        command.layer = Common::LAYER_ENTITIES;
+        out.push_back(command);
+    }
+}
@@ -0,0 +1,398 @@
+#include <algorithm>
+#include <atomic>
+#include <bit>
+#include <functional>
+#include <limits>
+#include <vector>
+
+#include "Gameplay/FlowField.hpp"
+#include "Gameplay/Collision.hpp"
+
+#include "Utils/Profiler.hpp"
+
+namespace
+{
+    // Typical links per node (two walks plus a jump or a fall); only sizes each band's first allocation
+    constexpr size_t FLOW_LINKS_PER_NODE_HINT = 3;
+}
+
+/**
+ * @brief Packs the solid tiles into a bitset, derives the standing tiles from it a word at a time,
+ * ranks them into node indices, then collects each node's links.
+ *
+ * Rows are independent in every pass, so with `jobs` bands of FLOW_ROW_GRAIN rows run in
+ * parallel; each band writes its own words and its own link list, and the lists are joined in
+ * band order, which is node order. The reversed links are then laid out with a counting sort.
+ */
+void Gameplay::FlowField::build(const Tilemap &map, Utils::JobSystem *jobs)
+{
+    PROFILE_ZONE("FlowField::build");
+    m_width = map.getWidthInTiles();
+    m_height = map.getHeightInTiles();
+    m_wordsPerRow = ((size_t)m_width + 63) / 64;
+
+    auto forEachRowBand = [&](const std::function<void(size_t, size_t)> &body)
+    {
+        if (jobs)
+            jobs->parallelFor((size_t)m_height, FLOW_ROW_GRAIN, body);
+        else
+            body(0, (size_t)m_height);
+    };
+
+    // Chunk rows are contiguous in the chunk-major tiles, so each row is read as CHUNK_SIZE-tile runs
+    std::vector<uint64_t> solid(m_wordsPerRow * (size_t)m_height, 0);
+    const TileType *tiles = map.getTileData();
+    forEachRowBand([&](size_t begin, size_t end)
+                   {
+        for (size_t y = begin; y < end; y++)
+        {
+            uint64_t *row = solid.data() + y * m_wordsPerRow;
+            const size_t chunkRow = y / Common::CHUNK_SIZE * (size_t)map.getWidthInChunks();
+            const size_t localRow = y % Common::CHUNK_SIZE * Common::CHUNK_SIZE;
+            for (int chunkX = 0; chunkX < map.getWidthInChunks(); chunkX++)
+            {
+                const TileType *run = tiles + (chunkRow + (size_t)chunkX) * Common::CHUNK_SIZE * Common::CHUNK_SIZE + localRow;
+                for (int i = 0; i < Common::CHUNK_SIZE; i++)
+                {
+                    const int x = chunkX * Common::CHUNK_SIZE + i;
+                    if (isSolid(run[i]))
+                        row[x / 64] |= (uint64_t)1 << (x % 64);
+                }
+            }
+        } });
+
+    // Standing: solid below, FLOW_CLEARANCE_TILES free rows up to and including this one; rows outside the map are solid
+    m_standing.assign(solid.size(), 0);
+    forEachRowBand([&](size_t begin, size_t end)
+                   {
+        for (size_t y = begin; y < end; y++)
+        {
+            for (size_t word = 0; word < m_wordsPerRow; word++)
+            {
+                const size_t bitsLeft = (size_t)m_width - word * 64;
+                uint64_t standing = bitsLeft >= 64 ? ~(uint64_t)0 : ((uint64_t)1 << bitsLeft) - 1;
+                if (y + 1 < (size_t)m_height)
+                    standing &= solid[(y + 1) * m_wordsPerRow + word];
+                for (size_t r = 0; r < (size_t)FLOW_CLEARANCE_TILES; r++)
+                    standing &= y >= r ? ~solid[(y - r) * m_wordsPerRow + word] : 0;
+                m_standing[y * m_wordsPerRow + word] = standing;
+            }
+        } });
+
+    m_rankBase.resize(m_standing.size());
+    uint32_t nodeCount = 0;
+    for (size_t word = 0; word < m_standing.size(); word++)
+    {
+        m_rankBase[word] = nodeCount;
+        nodeCount += (uint32_t)std::popcount(m_standing[word]);
+    }
+
+    // Each band collects its nodes' links; the per-node counts go to m_linkStart[node + 1]
+    m_linkStart.assign((size_t)nodeCount + 1, 0);
+    std::vector<std::vector<Link>> bandLinks(((size_t)m_height + FLOW_ROW_GRAIN - 1) / FLOW_ROW_GRAIN);
+    forEachRowBand([&](size_t begin, size_t end)
+                   {
+        std::vector<Link> &links = bandLinks[begin / FLOW_ROW_GRAIN];
+        const uint32_t bandEnd = end < (size_t)m_height ? m_rankBase[end * m_wordsPerRow] : nodeCount;
+        links.reserve((size_t)(bandEnd - m_rankBase[begin * m_wordsPerRow]) * FLOW_LINKS_PER_NODE_HINT);
+        for (int y = (int)begin; y < (int)end; y++)
+        {
+            for (size_t word = 0; word < m_wordsPerRow; word++)
+            {
+                const size_t index = (size_t)y * m_wordsPerRow + word;
+                uint32_t node = m_rankBase[index];
+                for (uint64_t bits = m_standing[index]; bits != 0; bits &= bits - 1, node++)
+                {
+                    const size_t before = links.size();
+                    collectLinks(solid, (int)(word * 64) + std::countr_zero(bits), y, links);
+                    m_linkStart[(size_t)node + 1] = (uint32_t)(links.size() - before);
+                }
+            }
+        } });
+
+    for (size_t node = 0; node < nodeCount; node++)
+        m_linkStart[node + 1] += m_linkStart[node];
+    const size_t linkCount = m_linkStart[nodeCount];
+    m_linkTarget.resize(linkCount);
+    m_linkCost.resize(linkCount);
+    m_linkMove.resize(linkCount);
+    size_t next = 0;
+    m_maxLinkCost = 1;
+    for (const std::vector<Link> &links : bandLinks)
+    {
+        for (const Link &link : links)
+        {
+            m_linkTarget[next] = link.target;
+            m_linkCost[next] = link.cost;
+            m_linkMove[next] = link.move;
+            m_maxLinkCost = std::max<uint32_t>(m_maxLinkCost, link.cost);
+            next++;
+        }
+    }
+
+    m_reverseStart.assign((size_t)nodeCount + 1, 0);
+    for (uint32_t target : m_linkTarget)
+        m_reverseStart[(size_t)target + 1]++;
+    for (size_t node = 0; node < nodeCount; node++)
+        m_reverseStart[node + 1] += m_reverseStart[node];
+    m_reverseSource.resize(linkCount);
+    m_reverseCost.resize(linkCount);
+    std::vector<uint32_t> fill(m_reverseStart.begin(), m_reverseStart.end() - 1);
+    for (uint32_t node = 0; node < nodeCount; node++)
+    {
+        for (uint32_t link = m_linkStart[node]; link < m_linkStart[(size_t)node + 1]; link++)
+        {
+            const uint32_t slot = fill[m_linkTarget[link]]++;
+            m_reverseSource[slot] = node;
+            m_reverseCost[slot] = m_linkCost[link];
+        }
+    }
+
+    m_distance.assign(nodeCount, UNREACHABLE);
+    m_move.assign(nodeCount, FlowMove::FLOW_UNREACHABLE);
+    m_buckets.assign((size_t)m_maxLinkCost + 1, {});
+    m_queued = 0;
+    m_reached = 0;
+    invalidate();
+}
+
+uint32_t Gameplay::FlowField::nodeAt(int tileX, int tileY) const
+{
+    if (tileX < 0 || tileY < 0 || tileX >= m_width || tileY >= m_height)
+        return NO_NODE;
+    const size_t index = (size_t)tileY * m_wordsPerRow + (size_t)tileX / 64;
+    const uint64_t bit = (uint64_t)1 << (tileX % 64);
+    if ((m_standing[index] & bit) == 0)
+        return NO_NODE;
+    return m_rankBase[index] + (uint32_t)std::popcount(m_standing[index] & (bit - 1));
+}
+
+/**
+ * @brief Walk and fall links to each side, then jumps: rise in this column, move across at the landing height.
+ *
+ * A fall needs the tile beside to be free with headroom; the enemy drops straight down from
+ * there. A jump is cut off at the first height where the rise hits a solid tile and, per height,
+ * at the first column blocked on the way across. Level jumps are only kept across gaps.
+ */
+void Gameplay::FlowField::collectLinks(const std::vector<uint64_t> &solidBits, int tileX, int tileY, std::vector<Link> &out) const
+{
+    auto solid = [&](int x, int y)
+    {
+        if (x < 0 || y < 0 || x >= m_width || y >= m_height)
+            return true;
+        return ((solidBits[(size_t)y * m_wordsPerRow + (size_t)x / 64] >> (x % 64)) & 1) != 0;
+    };
+    auto columnClear = [&solid](int x, int top, int bottom)
+    {
+        for (int y = top; y <= bottom; y++)
+        {
+            if (solid(x, y))
+                return false;
+        }
+        return true;
+    };
+
+    for (const int side : {-1, 1})
+    {
+        const FlowMove walk = side < 0 ? FlowMove::FLOW_LEFT : FlowMove::FLOW_RIGHT;
+        const FlowMove jump = side < 0 ? FlowMove::FLOW_JUMP_LEFT : FlowMove::FLOW_JUMP_RIGHT;
+        const int besideX = tileX + side;
+        const uint32_t beside = nodeAt(besideX, tileY);
+
+        if (beside != NO_NODE)
+        {
+            out.push_back({beside, 1, walk});
+        }
+        else if (columnClear(besideX, tileY - FLOW_CLEARANCE_TILES + 1, tileY))
+        {
+            int landY = tileY + 1; // Rows outside the map are solid, so this stops at the bottom row
+            while (!solid(besideX, landY + 1))
+                landY++;
+            const uint32_t landing = nodeAt(besideX, landY);
+            if (landing != NO_NODE)
+            {
+                const int cost = std::min(1 + landY - tileY, (int)std::numeric_limits<uint16_t>::max());
+                out.push_back({landing, (uint16_t)cost, walk});
+            }
+        }
+
+        for (int rise = 0; rise <= FLOW_JUMP_HEIGHT_TILES; rise++)
+        {
+            const int headY = tileY - rise - FLOW_CLEARANCE_TILES + 1;
+            if (solid(tileX, headY))
+                break;
+            for (int across = 1; across <= FLOW_JUMP_REACH_TILES; across++)
+            {
+                const int x = tileX + side * across;
+                if (!columnClear(x, headY, tileY - rise))
+                    break;
+                if (rise == 0 && (across == 1 || beside != NO_NODE))
+                    continue;
+                const uint32_t landing = nodeAt(x, tileY - rise);
+                if (landing != NO_NODE)
+                    out.push_back({landing, (uint16_t)(across + rise + FLOW_JUMP_COST), jump});
+            }
+        }
+    }
+}
+
+bool Gameplay::FlowField::update(float targetX, float targetY, Utils::JobSystem *jobs)
+{
+    // Drop to the first standing tile at or below the target, the way a falling player would land
+    const int tileX = (int)std::floor(targetX / Common::TILE_SIZE);
+    int tileY = std::max((int)std::floor(targetY / Common::TILE_SIZE), 0);
+    uint32_t target = NO_NODE;
+    if (tileX >= 0 && tileX < m_width)
+    {
+        for (; tileY < m_height && target == NO_NODE; tileY++)
+            target = nodeAt(tileX, tileY);
+    }
+
+    if (m_hasField && target == m_target)
+        return false;
+    m_target = target;
+    m_hasField = true;
+    rebuild(jobs);
+    return true;
+}
+
+void Gameplay::FlowField::queueNode(uint32_t node, uint32_t distance)
+{
+    m_buckets[distance % m_buckets.size()].push_back(node);
+    m_queued++;
+}
+
+/**
+ * @brief Dial's algorithm: distances are settled bucket by bucket in increasing order, then each
+ * node takes the link whose cost plus target distance is smallest (the first one on ties).
+ *
+ * Link costs are at most m_maxLinkCost, so a ring of m_maxLinkCost + 1 buckets holds every queued
+ * distance. Nodes are queued again when improved and stale entries are skipped.
+ */
+void Gameplay::FlowField::rebuild(Utils::JobSystem *jobs)
+{
+    PROFILE_ZONE("FlowField::rebuild");
+    std::fill(m_distance.begin(), m_distance.end(), UNREACHABLE);
+    m_reached = 0;
+
+    if (m_target != NO_NODE)
+    {
+        m_distance[m_target] = 0;
+        queueNode(m_target, 0);
+        for (uint32_t distance = 0; m_queued > 0; distance++)
+        {
+            std::vector<uint32_t> &bucket = m_buckets[distance % m_buckets.size()];
+            if (bucket.empty())
+                continue;
+            m_queued -= bucket.size();
+            relaxBucket(bucket, distance, jobs);
+            bucket.clear();
+        }
+    }
+
+    auto chooseMoves = [this](size_t begin, size_t end)
+    {
+        for (size_t node = begin; node < end; node++)
+        {
+            if (m_distance[node] == UNREACHABLE)
+            {
+                m_move[node] = FlowMove::FLOW_UNREACHABLE;
+                continue;
+            }
+            if (node == m_target)
+            {
+                m_move[node] = FlowMove::FLOW_ARRIVED;
+                continue;
+            }
+            uint32_t best = UNREACHABLE;
+            for (uint32_t link = m_linkStart[node]; link < m_linkStart[node + 1]; link++)
+            {
+                const uint32_t through = m_distance[m_linkTarget[link]];
+                if (through == UNREACHABLE || through + m_linkCost[link] >= best)
+                    continue;
+                best = through + m_linkCost[link];
+                m_move[node] = m_linkMove[link];
+            }
+        }
+    };
+    if (jobs)
+        jobs->parallelFor(m_move.size(), FLOW_JOB_GRAIN, chooseMoves);
+    else
+        chooseMoves(0, m_move.size());
+}
+
+/**
+ * @brief Settles the bucket's live entries and relaxes the links into them.
+ *
+ * Large buckets are split over the worker pool: distances are lowered with a compare-and-swap
+ * minimum, each job lists the sources it improved, and the lists are queued in job order,
+ * skipping entries another job has since beaten. Settled nodes are never lowered, so the
+ * distances come out the same as the serial pass.
+ */
+void Gameplay::FlowField::relaxBucket(std::vector<uint32_t> &bucket, uint32_t distance, Utils::JobSystem *jobs)
+{
+    if (!jobs || bucket.size() < FLOW_PARALLEL_FRONTIER)
+    {
+        for (const uint32_t node : bucket)
+        {
+            if (m_distance[node] != distance)
+                continue;
+            m_reached++;
+            for (uint32_t link = m_reverseStart[node]; link < m_reverseStart[(size_t)node + 1]; link++)
+            {
+                const uint32_t source = m_reverseSource[link];
+                const uint32_t through = distance + m_reverseCost[link];
+                if (through < m_distance[source])
+                {
+                    m_distance[source] = through;
+                    queueNode(source, through);
+                }
+            }
+        }
+        return;
+    }
+
+    const size_t jobCount = (bucket.size() + FLOW_JOB_GRAIN - 1) / FLOW_JOB_GRAIN;
+    if (m_jobImproved.size() < jobCount)
+        m_jobImproved.resize(jobCount);
+    std::atomic<size_t> settled{0};
+    jobs->parallelFor(bucket.size(), FLOW_JOB_GRAIN, [&](size_t begin, size_t end)
+                      {
+        std::vector<uint32_t> &improved = m_jobImproved[begin / FLOW_JOB_GRAIN];
+        improved.clear();
+        size_t settledHere = 0;
+        for (size_t i = begin; i < end; i++)
+        {
+            const uint32_t node = bucket[i];
+            if (m_distance[node] != distance)
+                continue;
+            settledHere++;
+            for (uint32_t link = m_reverseStart[node]; link < m_reverseStart[(size_t)node + 1]; link++)
+            {
+                const uint32_t source = m_reverseSource[link];
+                const uint32_t through = distance + m_reverseCost[link];
+                std::atomic_ref<uint32_t> sourceDistance(m_distance[source]);
+                uint32_t current = sourceDistance.load(std::memory_order_relaxed);
+                while (through < current && !sourceDistance.compare_exchange_weak(current, through, std::memory_order_relaxed))
+                {
+                }
+                if (through < current)
+                {
+                    improved.push_back(source);
+                    improved.push_back(through);
+                }
+            }
+        }
+        settled.fetch_add(settledHere, std::memory_order_relaxed); });
+
+    m_reached += settled.load(std::memory_order_relaxed);
+    for (size_t job = 0; job < jobCount; job++)
+    {
+        const std::vector<uint32_t> &improved = m_jobImproved[job];
+        for (size_t i = 0; i < improved.size(); i += 2)
+        {
+            if (m_distance[improved[i]] == improved[i + 1])
+                queueNode(improved[i], improved[i + 1]);
+        }
+    }
+}
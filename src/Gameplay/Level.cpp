@@ -0,0 +1,186 @@
+#include <SDL3/SDL.h>
+#include <bit>
+#include <cstdio>
+#include <cstring>
+
+#include "Gameplay/Level.hpp"
+
+#include "Common/Constants.hpp"
+
+static_assert(std::endian::native == std::endian::little, "Level files are used in place and store little-endian values");
+
+namespace
+{
+    // Keeps every pixel coordinate of a level within int range
+    constexpr uint32_t MAX_LEVEL_CHUNKS_PER_SIDE = 16384;
+    constexpr size_t TILES_PER_CHUNK = (size_t)Common::CHUNK_SIZE * Common::CHUNK_SIZE;
+
+    uint64_t alignSection(uint64_t offset)
+    {
+        return (offset + Gameplay::LEVEL_SECTION_ALIGNMENT - 1) / Gameplay::LEVEL_SECTION_ALIGNMENT * Gameplay::LEVEL_SECTION_ALIGNMENT;
+    }
+
+    /**
+     * @brief Checks that [offset, offset + size) is aligned and lies inside the file; `size` may be 0.
+     */
+    bool sectionFits(uint64_t offset, uint64_t size, uint64_t fileSize)
+    {
+        return offset % Gameplay::LEVEL_SECTION_ALIGNMENT == 0 && offset <= fileSize && size <= fileSize - offset;
+    }
+
+    /**
+     * @brief Returns why the mapped bytes are not a usable level, or nullptr if they are.
+     *
+     * Only the header, the section layout, the chunk table and the spawns are looked at; the cost
+     * does not depend on the number of tiles.
+     */
+    const char *validate(const uint8_t *data, size_t size)
+    {
+        if (size < sizeof(Gameplay::LevelHeader))
+            return "file is smaller than the level header";
+
+        const Gameplay::LevelHeader &header = *(const Gameplay::LevelHeader *)data;
+        if (std::memcmp(header.magic, Gameplay::LEVEL_MAGIC, sizeof(Gameplay::LEVEL_MAGIC)) != 0)
+            return "not a level file";
+        if (header.version != Gameplay::LEVEL_FORMAT_VERSION || header.headerSize != sizeof(Gameplay::LevelHeader))
+            return "unsupported level format version";
+        if (header.chunkSize != (uint32_t)Common::CHUNK_SIZE)
+            return "chunk size differs from this build's Common::CHUNK_SIZE";
+        if (header.widthInChunks == 0 || header.heightInChunks == 0 || header.widthInChunks > MAX_LEVEL_CHUNKS_PER_SIDE ||
+            header.heightInChunks > MAX_LEVEL_CHUNKS_PER_SIDE)
+            return "level dimensions out of range";
+        if (header.fileSize != size)
+            return "file size does not match the header (truncated?)";
+
+        const uint64_t chunkCount = (uint64_t)header.widthInChunks * header.heightInChunks;
+        if (!sectionFits(header.chunkTableOffset, chunkCount * sizeof(uint16_t), size) ||
+            !sectionFits(header.tilesOffset, chunkCount * TILES_PER_CHUNK, size) ||
+            !sectionFits(header.spawnsOffset, (uint64_t)header.spawnCount * sizeof(Gameplay::LevelSpawn), size))
+            return "section outside the file or misaligned";
+
+        const uint16_t *counts = (const uint16_t *)(data + header.chunkTableOffset);
+        for (uint64_t chunk = 0; chunk < chunkCount; chunk++)
+        {
+            if (counts[chunk] > TILES_PER_CHUNK)
+                return "chunk table entry larger than a chunk";
+        }
+
+        const Gameplay::LevelSpawn *spawns = (const Gameplay::LevelSpawn *)(data + header.spawnsOffset);
+        for (uint32_t i = 0; i < header.spawnCount; i++)
+        {
+            if (spawns[i].kind != Gameplay::EntityKind::ENTITY_PLAYER && spawns[i].kind != Gameplay::EntityKind::ENTITY_ENEMY)
+                return "spawn of an unsupported entity kind";
+        }
+        return nullptr;
+    }
+
+    bool writePadding(std::FILE *file, uint64_t &position, uint64_t target)
+    {
+        static const uint8_t zeros[Gameplay::LEVEL_SECTION_ALIGNMENT] = {};
+        const size_t count = (size_t)(target - position);
+        position = target;
+        return count == 0 || std::fwrite(zeros, 1, count, file) == count;
+    }
+}
+
+bool Gameplay::Level::open(const std::string &path)
+{
+    m_file.reset();
+    m_header = nullptr;
+
+    auto file = std::make_shared<Utils::MappedFile>();
+    if (!file->open(path))
+        return false;
+    if (const char *error = validate(file->data(), file->size()))
+    {
+        SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Level %s rejected: %s", path.c_str(), error);
+        return false;
+    }
+
+    m_header = (const LevelHeader *)file->data();
+    m_file = std::move(file);
+    return true;
+}
+
+Gameplay::Tilemap Gameplay::Level::createTilemap() const
+{
+    if (!m_header)
+        return Tilemap(1, 1);
+    const uint8_t *data = m_file->data();
+    return Tilemap((int)m_header->widthInChunks, (int)m_header->heightInChunks, (const TileType *)(data + m_header->tilesOffset),
+                   (const uint16_t *)(data + m_header->chunkTableOffset), m_file);
+}
+
+std::span<const Gameplay::LevelSpawn> Gameplay::Level::getSpawns() const
+{
+    if (!m_header)
+        return {};
+    return {(const LevelSpawn *)(m_file->data() + m_header->spawnsOffset), m_header->spawnCount};
+}
+
+/**
+ * @brief Lays the sections out back to back at aligned offsets and streams them out with fwrite.
+ */
+bool Gameplay::writeLevel(const std::string &path, const Tilemap &map, std::span<const LevelSpawn> spawns)
+{
+    const uint64_t chunkCount = (uint64_t)map.getWidthInChunks() * map.getHeightInChunks();
+
+    LevelHeader header{};
+    std::memcpy(header.magic, LEVEL_MAGIC, sizeof(LEVEL_MAGIC));
+    header.version = LEVEL_FORMAT_VERSION;
+    header.headerSize = sizeof(LevelHeader);
+    header.chunkSize = (uint32_t)Common::CHUNK_SIZE;
+    header.widthInChunks = (uint32_t)map.getWidthInChunks();
+    header.heightInChunks = (uint32_t)map.getHeightInChunks();
+    header.spawnCount = (uint32_t)spawns.size();
+    header.chunkTableOffset = alignSection(sizeof(LevelHeader));
+    header.tilesOffset = alignSection(header.chunkTableOffset + chunkCount * sizeof(uint16_t));
+    header.spawnsOffset = alignSection(header.tilesOffset + chunkCount * TILES_PER_CHUNK);
+    header.fileSize = header.spawnsOffset + spawns.size() * sizeof(LevelSpawn);
+
+    std::FILE *file = std::fopen(path.c_str(), "wb");
+    if (!file)
+    {
+        SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Could not open level %s for writing", path.c_str());
+        return false;
+    }
+
+    uint64_t position = sizeof(LevelHeader);
+    bool ok = std::fwrite(&header, sizeof(header), 1, file) == 1;
+    ok = ok && writePadding(file, position, header.chunkTableOffset) &&
+         std::fwrite(map.getChunkTileCounts(), sizeof(uint16_t), (size_t)chunkCount, file) == chunkCount;
+    position += chunkCount * sizeof(uint16_t);
+    ok = ok && writePadding(file, position, header.tilesOffset) &&
+         std::fwrite(map.getTileData(), TILES_PER_CHUNK, (size_t)chunkCount, file) == chunkCount;
+    position += chunkCount * TILES_PER_CHUNK;
+    ok = ok && writePadding(file, position, header.spawnsOffset) &&
+         std::fwrite(spawns.data(), sizeof(LevelSpawn), spawns.size(), file) == spawns.size();
+    ok = std::fclose(file) == 0 && ok;
+
+    if (!ok)
+        SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Failed to write level %s", path.c_str());
+    return ok;
+}
+
+std::vector<Gameplay::LevelSpawn> Gameplay::createTestSpawns(const Tilemap &map)
+{
+    std::vector<LevelSpawn> spawns;
+
+    const float floorY = map.getPixelHeight() - 2.0f * Common::TILE_SIZE;
+    spawns.push_back({2.0f * Common::TILE_SIZE, floorY - Common::PLAYER_HEIGHT, EntityKind::ENTITY_PLAYER});
+
+    for (int tileX = 1; tileX < map.getWidthInTiles() - 1; tileX++)
+    {
+        for (int tileY = 1; tileY < map.getHeightInTiles() - 2; tileY++)
+        {
+            // Platform starts: solid tile with an empty tile to its left and open space above
+            if (map.getTile(tileX, tileY) == TileType::TILE_FLOOR && map.getTile(tileX - 1, tileY) == TileType::TILE_EMPTY &&
+                map.getTile(tileX, tileY - 1) == TileType::TILE_EMPTY)
+            {
+                spawns.push_back({(float)(tileX * Common::TILE_SIZE), tileY * Common::TILE_SIZE - Common::ENEMY_HEIGHT,
+                                  EntityKind::ENTITY_ENEMY});
+            }
+        }
+    }
+    return spawns;
+}
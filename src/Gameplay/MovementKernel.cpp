@@ -0,0 +1,152 @@
+#include <cstddef>
+
+#include "Gameplay/MovementKernel.hpp"
+
+#if defined(__x86_64__) || defined(__i386__)
+#define MOVEMENT_KERNEL_X86 1
+#include <immintrin.h>
+#endif
+
+// Note: every variant must evaluate the same operations in the same order and must not be
+// contracted into FMAs, otherwise the bit-identical guarantee between ISAs is lost.
+
+namespace
+{
+    // Same semantics as MAXPS/MINPS: the second operand wins on ties and NaNs
+    inline float maxps(float a, float b) { return a > b ? a : b; }
+    inline float minps(float a, float b) { return a < b ? a : b; }
+
+    void updateVelocitiesScalar(const Gameplay::MovementParams &params, const float *moveDir, float *velX, float *velY,
+                                size_t begin, size_t count, float deltaTime)
+    {
+        const float accel = params.acceleration * deltaTime;
+        const float fric = params.friction * deltaTime;
+        const float grav = params.gravity * deltaTime;
+
+        for (size_t i = begin; i < count; i++)
+        {
+            const float vx = velX[i];
+            const float dir = moveDir[i];
+
+            float left = vx - accel;
+            left = left >= 0.0f ? left - fric : left;
+            left = maxps(left, -params.maxSpeed);
+
+            float right = vx + accel;
+            right = right <= 0.0f ? right + fric : right;
+            right = minps(right, params.maxSpeed);
+
+            float idle = vx > 0.0f ? maxps(vx - fric, 0.0f) : vx;
+            idle = vx < 0.0f ? minps(vx + fric, 0.0f) : idle;
+
+            float result = dir > 0.0f ? right : idle;
+            velX[i] = dir < 0.0f ? left : result;
+            velY[i] = minps(velY[i] + grav, params.terminalVelocity);
+        }
+    }
+
+#ifdef MOVEMENT_KERNEL_X86
+    // SSE2 has no blendv, so selects are built from and/andnot/or
+    inline __m128 select(__m128 mask, __m128 a, __m128 b) { return _mm_or_ps(_mm_and_ps(mask, a), _mm_andnot_ps(mask, b)); }
+
+    size_t updateVelocitiesSse(const Gameplay::MovementParams &params, const float *moveDir, float *velX, float *velY,
+                               size_t count, float deltaTime)
+    {
+        const __m128 zero = _mm_setzero_ps();
+        const __m128 accel = _mm_set1_ps(params.acceleration * deltaTime);
+        const __m128 fric = _mm_set1_ps(params.friction * deltaTime);
+        const __m128 grav = _mm_set1_ps(params.gravity * deltaTime);
+        const __m128 maxSpeed = _mm_set1_ps(params.maxSpeed);
+        const __m128 negMaxSpeed = _mm_set1_ps(-params.maxSpeed);
+        const __m128 terminal = _mm_set1_ps(params.terminalVelocity);
+
+        size_t i = 0;
+        for (; i + 4 <= count; i += 4)
+        {
+            const __m128 vx = _mm_loadu_ps(velX + i);
+            const __m128 dir = _mm_loadu_ps(moveDir + i);
+
+            __m128 left = _mm_sub_ps(vx, accel);
+            left = select(_mm_cmpge_ps(left, zero), _mm_sub_ps(left, fric), left);
+            left = _mm_max_ps(left, negMaxSpeed);
+
+            __m128 right = _mm_add_ps(vx, accel);
+            right = select(_mm_cmple_ps(right, zero), _mm_add_ps(right, fric), right);
+            right = _mm_min_ps(right, maxSpeed);
+
+            __m128 idle = select(_mm_cmpgt_ps(vx, zero), _mm_max_ps(_mm_sub_ps(vx, fric), zero), vx);
+            idle = select(_mm_cmplt_ps(vx, zero), _mm_min_ps(_mm_add_ps(vx, fric), zero), idle);
+
+            __m128 result = select(_mm_cmpgt_ps(dir, zero), right, idle);
+            result = select(_mm_cmplt_ps(dir, zero), left, result);
+            _mm_storeu_ps(velX + i, result);
+
+            const __m128 vy = _mm_add_ps(_mm_loadu_ps(velY + i), grav);
+            _mm_storeu_ps(velY + i, _mm_min_ps(vy, terminal));
+        }
+        return i;
+    }
+
+    __attribute__((target("avx2"))) size_t updateVelocitiesAvx2(const Gameplay::MovementParams &params, const float *moveDir, float *velX,
+                                                                 float *velY, size_t count, float deltaTime)
+    {
+        const __m256 zero = _mm256_setzero_ps();
+        const __m256 accel = _mm256_set1_ps(params.acceleration * deltaTime);
+        const __m256 fric = _mm256_set1_ps(params.friction * deltaTime);
+        const __m256 grav = _mm256_set1_ps(params.gravity * deltaTime);
+        const __m256 maxSpeed = _mm256_set1_ps(params.maxSpeed);
+        const __m256 negMaxSpeed = _mm256_set1_ps(-params.maxSpeed);
+        const __m256 terminal = _mm256_set1_ps(params.terminalVelocity);
+
+        size_t i = 0;
+        for (; i + 8 <= count; i += 8)
+        {
+            const __m256 vx = _mm256_loadu_ps(velX + i);
+            const __m256 dir = _mm256_loadu_ps(moveDir + i);
+
+            __m256 left = _mm256_sub_ps(vx, accel);
+            left = _mm256_blendv_ps(left, _mm256_sub_ps(left, fric), _mm256_cmp_ps(left, zero, _CMP_GE_OQ));
+            left = _mm256_max_ps(left, negMaxSpeed);
+
+            __m256 right = _mm256_add_ps(vx, accel);
+            right = _mm256_blendv_ps(right, _mm256_add_ps(right, fric), _mm256_cmp_ps(right, zero, _CMP_LE_OQ));
+            right = _mm256_min_ps(right, maxSpeed);
+
+            __m256 idle = _mm256_blendv_ps(vx, _mm256_max_ps(_mm256_sub_ps(vx, fric), zero), _mm256_cmp_ps(vx, zero, _CMP_GT_OQ));
+            idle = _mm256_blendv_ps(idle, _mm256_min_ps(_mm256_add_ps(vx, fric), zero), _mm256_cmp_ps(vx, zero, _CMP_LT_OQ));
+
+            __m256 result = _mm256_blendv_ps(idle, right, _mm256_cmp_ps(dir, zero, _CMP_GT_OQ));
+            result = _mm256_blendv_ps(result, left, _mm256_cmp_ps(dir, zero, _CMP_LT_OQ));
+            _mm256_storeu_ps(velX + i, result);
+
+            const __m256 vy = _mm256_add_ps(_mm256_loadu_ps(velY + i), grav);
+            _mm256_storeu_ps(velY + i, _mm256_min_ps(vy, terminal));
+        }
+        return i;
+    }
+#endif
+}
+
+/**
+ * @brief Updates whole 8- or 4-entity groups with the AVX2 or SSE2 loop and the remaining entities with the scalar one.
+ */
+void Gameplay::updateVelocities(Utils::SimdLevel level, const MovementParams &params, const float *moveDir, float *velX, float *velY, size_t count, float deltaTime)
+{
+    size_t done = 0;
+#ifdef MOVEMENT_KERNEL_X86
+    switch (Utils::clampToSupported(level))
+    {
+    case Utils::SimdLevel::SIMD_AVX2:
+        done = updateVelocitiesAvx2(params, moveDir, velX, velY, count, deltaTime);
+        break;
+    case Utils::SimdLevel::SIMD_SSE:
+        done = updateVelocitiesSse(params, moveDir, velX, velY, count, deltaTime);
+        break;
+    default:
+        break;
+    }
+#else
+    (void)level;
+#endif
+    updateVelocitiesScalar(params, moveDir, velX, velY, done, count, deltaTime);
+}
@@ -3,28 +3,64 @@
 #include "Common/Types.hpp"
 #include "Common/Constants.hpp"
 
-/ **
- * @brief Update the player's movement state for the current frame.
- *
- * Apply per-frame updates to the player's movement component using the elapsed
- * time and the current input state.
+/**
+ * @brief Creates the player's entity, replacing any previous one.
  *
- * @param deltaTime Time elapsed since the last update, in seconds.
- * @param input Current input state to influence movement.
+ * @param entities Store the entity is created in.
+ * @param x World x coordinate of the player's top-left corner.
+ * @param y World y coordinate of the player's top-left corner.
  */
-void Gameplay::Player::update(float deltaTime, const Common::InputState &input)
+void Gameplay::Player::spawn(EntityStore &entities, float x, float y)
 {
-    movement.update(deltaTime, input);
+    entities.destroy(m_handle);
+    m_handle = entities.create(EntityKind::ENTITY_PLAYER, x, y, Common::PLAYER_WIDTH, Common::PLAYER_HEIGHT, Common::TextureID::TEX_PLAYER);
+    m_attackCooldown = 0.0f;
 }
 
 /**
- * @brief Retrieves the render command representing the player's current visual state.
+ * @brief Update the player's movement state for the current step and handle shooting.
  *
- * The command is obtained from the player's movement component; the texture ID is stored as the last element of the returned command.
+ * Apply per-step updates to the player's entity using the elapsed
+ * time and the current input state.
  *
- * @return Common::RenderCommand Render command for the player.
+ * @param deltaTime Time elapsed since the last update, in seconds.
+ * @param input Current input state to influence movement.
+ * @param map Tile grid the player collides with.
+ * @param entities Store holding the player's entity.
  */
-Common::RenderCommand Gameplay::Player::getRenderCommand() const
+void Gameplay::Player::update(float deltaTime, const Common::InputState &input, const Tilemap &map, EntityStore &entities)
+{
+    movement.update(entities, m_handle, deltaTime, input, map);
+    m_firedThisStep = false;
+
+    if (m_attackCooldown > 0.0f)
+        m_attackCooldown -= deltaTime;
+
+    const size_t i = entities.indexOf(m_handle);
+    if (!input.attack || m_attackCooldown > 0.0f || i == EntityStore::NOT_FOUND)
+        return;
+
+    const bool facingLeft = (entities.flags[i] & ENTITY_FACING_LEFT) != 0;
+    const float x = facingLeft ? entities.posX[i] - Common::PROJECTILE_SIZE : entities.posX[i] + entities.width[i];
+    const float y = entities.posY[i] + (entities.height[i] - Common::PROJECTILE_SIZE) * 0.5f;
+
+    EntityHandle projectile = entities.create(EntityKind::ENTITY_PROJECTILE, x, y, Common::PROJECTILE_SIZE, Common::PROJECTILE_SIZE, Common::TextureID::TEX_PROJECTILE);
+    const size_t p = entities.indexOf(projectile);
+    entities.velX[p] = facingLeft ? -ProjectileProfile::maxSpeed : ProjectileProfile::maxSpeed;
+    entities.lifetime[p] = ProjectileProfile::lifetime;
+
+    m_attackCooldown = Common::ATTACK_COOLDOWN;
+    m_firedThisStep = true;
+}
+
+void Gameplay::Player::save(WorldSnapshot &out) const
 {
-    return movement.getRenderCommand(); // Texture Id at end
-}
\ No newline at end of file
+    out.write(m_handle);
+    out.write(m_attackCooldown);
+    out.alignToBlock();
+}
+
+bool Gameplay::Player::load(SnapshotReader &in)
+{
+    return in.read(m_handle) && in.read(m_attackCooldown) && in.alignToBlock();
+}
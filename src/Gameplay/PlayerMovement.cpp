@@ -1,96 +1,97 @@
 #include "Gameplay/PlayerMovement.hpp"
+#include "Gameplay/Collision.hpp"
 
 /**
- * @brief Updates the player's physics state and position based on input and elapsed time.
+ * @brief Updates a player entity's physics state and position based on input and elapsed time.
  *
  * Updates horizontal and vertical velocity using acceleration, gravity, and friction; clamps
- * velocities to configured limits; applies a jump when allowed; integrates position; and
- * enforces screen bounds. Landing on the bottom edge re-enables jumping.
+ * velocities to the profile's limits; applies a jump when allowed; then moves the entity through the
+ * tile grid with a swept AABB test. Touching the ground re-enables jumping. Stale handles are ignored.
  *
+ * @param entities Entity columns holding the player's position, velocity and flags.
+ * @param handle Player entity to move.
  * @param deltaTime Time elapsed since the last update in seconds.
  * @param input Input state containing movement flags (`left`, `right`, `jump`) that drive motion.
+ * @param map Tile grid the player collides with.
  */
-void Gameplay::PlayerMovement::update(float deltaTime, const Common::InputState &input)
+template <Gameplay::MovementProfile Profile>
+void Gameplay::BasicPlayerMovement<Profile>::update(EntityStore &entities, EntityHandle handle, float deltaTime, const Common::InputState &input,
+                                                    const Tilemap &map) const
 {
+    const float acceleration = m_profile.acceleration;
+    const float friction = m_profile.friction;
+    const float gravity = m_profile.gravity;
+    const float terminalVelocity = m_profile.terminalVelocity;
+    const float jumpForce = m_profile.jumpForce;
+    const float maxSpeed = m_profile.maxSpeed;
+
+    const size_t i = entities.indexOf(handle);
+    if (i == EntityStore::NOT_FOUND)
+        return;
+
+    float velocityX = entities.velX[i];
+    float velocityY = entities.velY[i];
+    const bool canJump = (entities.flags[i] & ENTITY_ON_GROUND) != 0;
+
     if (input.left)
     {
-        m_velocityX += -(acceleration * deltaTime);
-        m_velocityY += gravity * deltaTime;
-        if (m_velocityX >= 0)
-            m_velocityX += -(friction * deltaTime);
-        if (m_velocityX < -maxSpeed)
-            m_velocityX = -maxSpeed;
+        velocityX += -(acceleration * deltaTime);
+        velocityY += gravity * deltaTime;
+        if (velocityX >= 0)
+            velocityX += -(friction * deltaTime);
+        if (velocityX < -maxSpeed)
+            velocityX = -maxSpeed;
     }
 
     else if (input.right)
     {
-        m_velocityX += (acceleration * deltaTime);
-        m_velocityY += gravity * deltaTime;
-        if (m_velocityX <= 0)
-            m_velocityX += friction * deltaTime;
+        velocityX += (acceleration * deltaTime);
+        velocityY += gravity * deltaTime;
+        if (velocityX <= 0)
+            velocityX += friction * deltaTime;
 
-        if (m_velocityX > maxSpeed)
-            m_velocityX = maxSpeed;
+        if (velocityX > maxSpeed)
+            velocityX = maxSpeed;
     }
     else
     {
-        m_velocityY += gravity * deltaTime;
+        velocityY += gravity * deltaTime;
 
-        if (m_velocityX > 0)
+        if (velocityX > 0)
         {
-            m_velocityX -= friction * deltaTime;
-            if (m_velocityX < 0)
-                m_velocityX = 0;
+            velocityX -= friction * deltaTime;
+            if (velocityX < 0)
+                velocityX = 0;
         }
-        else if (m_velocityX < 0)
+        else if (velocityX < 0)
         {
-            m_velocityX += friction * deltaTime;
-            if (m_velocityX > 0)
-                m_velocityX = 0;
+            velocityX += friction * deltaTime;
+            if (velocityX > 0)
+                velocityX = 0;
         }
     }
-    if (m_velocityY > terminalVelocity)
-        m_velocityY = terminalVelocity;
+    if (velocityY > terminalVelocity)
+        velocityY = terminalVelocity;
 
-    if (input.jump && m_canJump)
-    {
-        m_velocityY = jumpForce;
-        m_canJump = false;
-    }
+    if (input.jump && canJump)
+        velocityY = jumpForce;
 
-    m_x += m_velocityX * deltaTime;
-    m_y += m_velocityY * deltaTime;
+    AABB box = {entities.posX[i], entities.posY[i], entities.width[i], entities.height[i]};
+    CollisionContacts contacts = moveAndCollide(map, box, velocityX, velocityY, deltaTime);
+    entities.posX[i] = box.x;
+    entities.posY[i] = box.y;
+    entities.velX[i] = velocityX;
+    entities.velY[i] = velocityY;
 
-    if (m_x < 0)
-    {
-        m_x = 0;
-        m_velocityX = 0;
-    }
-    if (m_x > Common::SCREEN_WIDTH - Common::PLAYER_WIDTH)
-    {
-        m_x = Common::SCREEN_WIDTH - Common::PLAYER_WIDTH;
-        m_velocityX = 0;
-    }
-    if (m_y < 0)
-    {
-        m_y = 0;
-        m_velocityY = 0;
-    }
-    if (m_y > Common::SCREEN_HEIGHT - Common::PLAYER_HEIGHT)
-    {
-        m_y = Common::SCREEN_HEIGHT - Common::PLAYER_HEIGHT;
-        m_velocityY = 0;
-        m_canJump = true;
-    }
+    uint8_t flags = entities.flags[i] & ~ENTITY_ON_GROUND;
+    if (contacts.ground)
+        flags |= ENTITY_ON_GROUND;
+    if (input.left)
+        flags |= ENTITY_FACING_LEFT;
+    else if (input.right)
+        flags &= ~ENTITY_FACING_LEFT;
+    entities.flags[i] = flags;
 }
 
-/**
- * @brief Produces a render command for the player using its current position and size.
- *
- * @return Common::RenderCommand A render command initialized with the player's x and y position,
- * width (Common::PLAYER_WIDTH), height (Common::PLAYER_HEIGHT), and texture ID (Common::TextureID::TEX_PLAYER).
- */
-Common::RenderCommand Gameplay::PlayerMovement::getRenderCommand() const
-{
-    return {m_x, m_y, Common::PLAYER_WIDTH, Common::PLAYER_HEIGHT, Common::TextureID::TEX_PLAYER}; // Texture Id at end
-}
\ No newline at end of file
+template class Gameplay::BasicPlayerMovement<Gameplay::PlayerProfile>;
+template class Gameplay::BasicPlayerMovement<Gameplay::TunableProfile>;
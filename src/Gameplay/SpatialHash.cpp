@@ -0,0 +1,195 @@
+#include <algorithm>
+#include <cmath>
+
+#include "Gameplay/SpatialHash.hpp"
+
+namespace
+{
+    // Buckets are kept at least twice the entry count so chains stay short
+    constexpr size_t MIN_BUCKETS = 1024;
+
+    size_t nextPowerOfTwo(size_t value)
+    {
+        size_t power = 1;
+        while (power < value)
+            power <<= 1;
+        return power;
+    }
+
+    /**
+     * @brief Slab test of the segment origin + t * direction, t in [0, maxT], against a box.
+     */
+    bool segmentHitsBox(float originX, float originY, float directionX, float directionY, float maxT,
+                        float minX, float minY, float maxX, float maxY)
+    {
+        float tEnter = 0.0f;
+        float tExit = maxT;
+
+        const float origin[2] = {originX, originY};
+        const float direction[2] = {directionX, directionY};
+        const float boxMin[2] = {minX, minY};
+        const float boxMax[2] = {maxX, maxY};
+        for (int axis = 0; axis < 2; axis++)
+        {
+            if (direction[axis] == 0.0f)
+            {
+                if (origin[axis] < boxMin[axis] || origin[axis] > boxMax[axis])
+                    return false;
+                continue;
+            }
+            const float inverse = 1.0f / direction[axis];
+            float t0 = (boxMin[axis] - origin[axis]) * inverse;
+            float t1 = (boxMax[axis] - origin[axis]) * inverse;
+            if (t0 > t1)
+                std::swap(t0, t1);
+            tEnter = std::max(tEnter, t0);
+            tExit = std::min(tExit, t1);
+            if (tEnter > tExit)
+                return false;
+        }
+        return true;
+    }
+}
+
+Gameplay::SpatialHash::SpatialHash(float cellSize)
+    : m_cellSize(cellSize), m_inverseCellSize(1.0f / cellSize)
+{
+}
+
+int32_t Gameplay::SpatialHash::cellOf(float coordinate) const
+{
+    return (int32_t)std::floor(coordinate * m_inverseCellSize);
+}
+
+size_t Gameplay::SpatialHash::bucketOf(int32_t cellX, int32_t cellY) const
+{
+    const uint32_t hash = (uint32_t)cellX * 73856093u ^ (uint32_t)cellY * 19349663u;
+    return hash & m_bucketMask;
+}
+
+/**
+ * @brief Counting sort of the boxes into buckets: count per bucket, prefix sum, then scatter.
+ *
+ * All buffers keep their capacity between builds, so a steady entity count does not allocate.
+ */
+void Gameplay::SpatialHash::build(const float *x, const float *y, const float *width, const float *height, size_t count)
+{
+    const size_t bucketCount = nextPowerOfTwo(std::max(MIN_BUCKETS, count * 2));
+    m_bucketMask = bucketCount - 1;
+    m_bucketStart.assign(bucketCount + 1, 0);
+    m_entryBucket.resize(count);
+    m_entries.resize(count);
+    m_maxWidth = 0.0f;
+    m_maxHeight = 0.0f;
+
+    for (size_t i = 0; i < count; i++)
+    {
+        const size_t bucket = bucketOf(cellOf(x[i]), cellOf(y[i]));
+        m_entryBucket[i] = (uint32_t)bucket;
+        m_bucketStart[bucket + 1]++;
+        m_maxWidth = std::max(m_maxWidth, width[i]);
+        m_maxHeight = std::max(m_maxHeight, height[i]);
+    }
+    for (size_t bucket = 0; bucket < bucketCount; bucket++)
+    {
+        m_bucketStart[bucket + 1] += m_bucketStart[bucket];
+    }
+
+    m_cursor.assign(m_bucketStart.begin(), m_bucketStart.end() - 1);
+    for (size_t i = 0; i < count; i++)
+    {
+        m_entries[m_cursor[m_entryBucket[i]]++] = {x[i], y[i], width[i], height[i], (uint32_t)i, cellOf(x[i]), cellOf(y[i])};
+    }
+}
+
+void Gameplay::SpatialHash::build(const EntityStore &entities)
+{
+    build(entities.posX.data(), entities.posY.data(), entities.width.data(), entities.height.data(), entities.size());
+}
+
+/**
+ * @brief Visits the candidate cells of a query region and keeps the boxes `test` accepts.
+ *
+ * When the region covers more cells than there are entries, every entry is tested directly instead.
+ */
+template <typename Test>
+size_t Gameplay::SpatialHash::gather(float minX, float minY, float maxX, float maxY, uint32_t *out, size_t capacity, const Test &test) const
+{
+    size_t found = 0;
+    auto accept = [&](const Entry &entry)
+    {
+        if (!test(entry))
+            return;
+        if (found < capacity)
+            out[found] = entry.index;
+        found++;
+    };
+
+    if (m_entries.empty())
+        return 0;
+
+    const int32_t firstX = cellOf(minX - m_maxWidth);
+    const int32_t firstY = cellOf(minY - m_maxHeight);
+    const int32_t lastX = cellOf(maxX);
+    const int32_t lastY = cellOf(maxY);
+    const double cellCount = ((double)lastX - firstX + 1) * ((double)lastY - firstY + 1);
+
+    if (cellCount > (double)m_entries.size())
+    {
+        for (const Entry &entry : m_entries)
+        {
+            accept(entry);
+        }
+        return found;
+    }
+
+    for (int32_t cellY = firstY; cellY <= lastY; cellY++)
+    {
+        for (int32_t cellX = firstX; cellX <= lastX; cellX++)
+        {
+            const size_t bucket = bucketOf(cellX, cellY);
+            for (uint32_t e = m_bucketStart[bucket]; e < m_bucketStart[bucket + 1]; e++)
+            {
+                const Entry &entry = m_entries[e];
+                if (entry.cellX == cellX && entry.cellY == cellY)
+                    accept(entry);
+            }
+        }
+    }
+    return found;
+}
+
+size_t Gameplay::SpatialHash::queryAABB(const AABB &box, uint32_t *out, size_t capacity) const
+{
+    const float maxX = box.x + box.width;
+    const float maxY = box.y + box.height;
+    return gather(box.x, box.y, maxX, maxY, out, capacity, [&](const Entry &entry)
+                  { return entry.x < maxX && entry.x + entry.width > box.x && entry.y < maxY && entry.y + entry.height > box.y; });
+}
+
+size_t Gameplay::SpatialHash::queryRadius(float centerX, float centerY, float radius, uint32_t *out, size_t capacity) const
+{
+    const float radiusSquared = radius * radius;
+    return gather(centerX - radius, centerY - radius, centerX + radius, centerY + radius, out, capacity, [&](const Entry &entry)
+                  {
+                      const float dx = centerX - std::clamp(centerX, entry.x, entry.x + entry.width);
+                      const float dy = centerY - std::clamp(centerY, entry.y, entry.y + entry.height);
+                      return dx * dx + dy * dy <= radiusSquared; });
+}
+
+/**
+ * @brief Gathers the cells under the segment's bounding box, then slab-tests each candidate box.
+ *
+ * Meant for short rays (attacks, line of sight within a screen); long rays fall back to testing
+ * every entry once their bounding box covers more cells than there are entries.
+ */
+size_t Gameplay::SpatialHash::queryRay(float originX, float originY, float directionX, float directionY, float maxDistance,
+                                       uint32_t *out, size_t capacity) const
+{
+    const float endX = originX + directionX * maxDistance;
+    const float endY = originY + directionY * maxDistance;
+    return gather(std::min(originX, endX), std::min(originY, endY), std::max(originX, endX), std::max(originY, endY), out, capacity,
+                  [&](const Entry &entry)
+                  { return segmentHitsBox(originX, originY, directionX, directionY, maxDistance,
+                                          entry.x, entry.y, entry.x + entry.width, entry.y + entry.height); });
+}
@@ -0,0 +1,210 @@
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+#include "Gameplay/Tilemap.hpp"
+
+#include "Common/Types.hpp"
+#include "Common/Constants.hpp"
+
+/**
+ * @brief Creates an empty map of the given size in chunks.
+ *
+ * @param widthInChunks Number of chunks along x; clamped to at least 1.
+ * @param heightInChunks Number of chunks along y; clamped to at least 1.
+ */
+Gameplay::Tilemap::Tilemap(int widthInChunks, int heightInChunks)
+    : m_widthInChunks(std::max(1, widthInChunks)), m_heightInChunks(std::max(1, heightInChunks))
+{
+    const size_t chunkCount = (size_t)m_widthInChunks * m_heightInChunks;
+    m_tiles.assign(chunkCount * Common::CHUNK_SIZE * Common::CHUNK_SIZE, TileType::TILE_EMPTY);
+    m_chunkTileCount.assign(chunkCount, 0);
+    m_chunkVersion.assign(chunkCount, 0);
+}
+
+Gameplay::Tilemap::Tilemap(int widthInChunks, int heightInChunks, const TileType *tiles, const uint16_t *chunkTileCounts,
+                           std::shared_ptr<const void> mapping)
+    : m_widthInChunks(std::max(1, widthInChunks)), m_heightInChunks(std::max(1, heightInChunks)),
+      m_mappedTiles(tiles), m_mappedChunkTileCount(chunkTileCounts), m_mapping(std::move(mapping))
+{
+    m_chunkVersion.assign((size_t)m_widthInChunks * m_heightInChunks, 0);
+}
+
+void Gameplay::Tilemap::detachMapping()
+{
+    const size_t chunkCount = (size_t)m_widthInChunks * m_heightInChunks;
+    m_tiles.assign(m_mappedTiles, m_mappedTiles + chunkCount * Common::CHUNK_SIZE * Common::CHUNK_SIZE);
+    m_chunkTileCount.assign(m_mappedChunkTileCount, m_mappedChunkTileCount + chunkCount);
+    m_mappedTiles = nullptr;
+    m_mappedChunkTileCount = nullptr;
+    m_mapping.reset();
+}
+
+/**
+ * @brief Maps a tile coordinate to its offset in chunk-major storage.
+ *
+ * The coordinate must be inside the map.
+ */
+size_t Gameplay::Tilemap::tileIndex(int tileX, int tileY) const
+{
+    const int chunkX = tileX / Common::CHUNK_SIZE;
+    const int chunkY = tileY / Common::CHUNK_SIZE;
+    const size_t chunk = (size_t)chunkY * m_widthInChunks + chunkX;
+    const int localX = tileX % Common::CHUNK_SIZE;
+    const int localY = tileY % Common::CHUNK_SIZE;
+    return chunk * Common::CHUNK_SIZE * Common::CHUNK_SIZE + (size_t)localY * Common::CHUNK_SIZE + localX;
+}
+
+Gameplay::TileType Gameplay::Tilemap::getTile(int tileX, int tileY) const
+{
+    if (tileX < 0 || tileY < 0 || tileX >= getWidthInTiles() || tileY >= getHeightInTiles())
+        return TileType::TILE_WALL;
+    return getTileData()[tileIndex(tileX, tileY)];
+}
+
+/**
+ * @brief Sets a tile and keeps the owning chunk's non-empty tile count and version in sync.
+ *
+ * Coordinates outside the map are ignored. The first edit of a mapped map copies it into its own storage.
+ */
+void Gameplay::Tilemap::setTile(int tileX, int tileY, TileType type)
+{
+    if (tileX < 0 || tileY < 0 || tileX >= getWidthInTiles() || tileY >= getHeightInTiles())
+        return;
+    if (m_mappedTiles)
+        detachMapping();
+
+    TileType &tile = m_tiles[tileIndex(tileX, tileY)];
+    const size_t chunk = (size_t)(tileY / Common::CHUNK_SIZE) * m_widthInChunks + tileX / Common::CHUNK_SIZE;
+    if (tile == TileType::TILE_EMPTY && type != TileType::TILE_EMPTY)
+        m_chunkTileCount[chunk]++;
+    else if (tile != TileType::TILE_EMPTY && type == TileType::TILE_EMPTY)
+        m_chunkTileCount[chunk]--;
+    if (tile != type)
+        m_chunkVersion[chunk]++;
+    tile = type;
+}
+
+uint32_t Gameplay::Tilemap::getChunkVersion(ChunkCoord chunk) const
+{
+    return m_chunkVersion[(size_t)chunk.y * m_widthInChunks + chunk.x];
+}
+
+/**
+ * @brief Walks the chunk rectangle under the camera and emits a command per chunk holding any tiles.
+ */
+void Gameplay::Tilemap::collectStaticChunks(const Camera &camera, Utils::FrameVector<Common::StaticChunkCommand> &out) const
+{
+    const int firstX = std::max(0, (int)std::floor(camera.x / Common::CHUNK_PIXELS));
+    const int firstY = std::max(0, (int)std::floor(camera.y / Common::CHUNK_PIXELS));
+    const int lastX = std::min(m_widthInChunks - 1, (int)std::floor((camera.x + camera.width) / Common::CHUNK_PIXELS));
+    const int lastY = std::min(m_heightInChunks - 1, (int)std::floor((camera.y + camera.height) / Common::CHUNK_PIXELS));
+
+    for (int chunkY = firstY; chunkY <= lastY; chunkY++)
+    {
+        for (int chunkX = firstX; chunkX <= lastX; chunkX++)
+        {
+            const size_t chunk = (size_t)chunkY * m_widthInChunks + chunkX;
+            if (getChunkTileCounts()[chunk] == 0)
+                continue;
+            Common::StaticChunkCommand command;
+            command.chunkX = chunkX;
+            command.chunkY = chunkY;
+            command.version = m_chunkVersion[chunk];
+            command.x = (float)(chunkX * Common::CHUNK_PIXELS) - camera.x;
+            command.y = (float)(chunkY * Common::CHUNK_PIXELS) - camera.y;
+            out.push_back(command);
+        }
+    }
+}
+
+/**
+ * @brief Emits the whole chunk through collectChunkCommands() with a camera covering exactly the chunk.
+ */
+void Gameplay::Tilemap::collectChunkLocalCommands(ChunkCoord chunk, Utils::FrameVector<Common::RenderCommand> &out) const
+{
+    Camera chunkView;
+    chunkView.x = (float)(chunk.x * Common::CHUNK_PIXELS);
+    chunkView.y = (float)(chunk.y * Common::CHUNK_PIXELS);
+    chunkView.width = (float)Common::CHUNK_PIXELS;
+    chunkView.height = (float)Common::CHUNK_PIXELS;
+    collectChunkCommands(chunk, chunkView, out);
+}
+
+/**
+ * @brief Clips the camera's tile range to one chunk and emits a command per non-empty tile in it.
+ */
+void Gameplay::Tilemap::collectChunkCommands(ChunkCoord chunk, const Camera &camera, Utils::FrameVector<Common::RenderCommand> &out) const
+{
+    const int firstTileX = std::max(0, (int)std::floor(camera.x / Common::TILE_SIZE));
+    const int firstTileY = std::max(0, (int)std::floor(camera.y / Common::TILE_SIZE));
+    const int lastTileX = std::min(getWidthInTiles() - 1, (int)std::floor((camera.x + camera.width) / Common::TILE_SIZE));
+    const int lastTileY = std::min(getHeightInTiles() - 1, (int)std::floor((camera.y + camera.height) / Common::TILE_SIZE));
+
+    const int chunkTileX = chunk.x * Common::CHUNK_SIZE;
+    const int chunkTileY = chunk.y * Common::CHUNK_SIZE;
+    const int x0 = std::max(firstTileX, chunkTileX) - chunkTileX;
+    const int y0 = std::max(firstTileY, chunkTileY) - chunkTileY;
+    const int x1 = std::min(lastTileX, chunkTileX + Common::CHUNK_SIZE - 1) - chunkTileX;
+    const int y1 = std::min(lastTileY, chunkTileY + Common::CHUNK_SIZE - 1) - chunkTileY;
+
+    const float tileSize = (float)Common::TILE_SIZE;
+    const size_t chunkIndex = (size_t)chunk.y * m_widthInChunks + chunk.x;
+    const TileType *tiles = getTileData() + chunkIndex * Common::CHUNK_SIZE * Common::CHUNK_SIZE;
+
+    for (int localY = y0; localY <= y1; localY++)
+    {
+        const TileType *row = tiles + localY * Common::CHUNK_SIZE;
+        for (int localX = x0; localX <= x1; localX++)
+        {
+            if (row[localX] == TileType::TILE_EMPTY)
+                continue;
+
+            Common::RenderCommand command;
+            command.x = (chunkTileX + localX) * tileSize - camera.x;
+            command.y = (chunkTileY + localY) * tileSize - camera.y;
+            command.width = tileSize;
+            command.height = tileSize;
+            command.textureID = row[localX] == TileType::TILE_WALL ? Common::TextureID::TEX_WALL : Common::TextureID::TEX_FLOOR;
+            command.layer = Common::LAYER_TILES;
+            out.push_back(command);
+        }
+    }
+}
+
+/**
+ * @brief Builds a level with a solid wall border, a two-tile floor and a deterministic series of platforms.
+ *
+ * @param widthInChunks Level width in chunks.
+ * @param heightInChunks Level height in chunks.
+ * @return Tilemap The generated level.
+ */
+Gameplay::Tilemap Gameplay::Tilemap::createTestLevel(int widthInChunks, int heightInChunks)
+{
+    Tilemap level(widthInChunks, heightInChunks);
+    const int width = level.getWidthInTiles();
+    const int height = level.getHeightInTiles();
+
+    for (int x = 0; x < width; x++)
+    {
+        level.setTile(x, 0, TileType::TILE_WALL);
+        level.setTile(x, height - 1, TileType::TILE_WALL);
+        level.setTile(x, height - 2, TileType::TILE_FLOOR);
+    }
+    for (int y = 0; y < height; y++)
+    {
+        level.setTile(0, y, TileType::TILE_WALL);
+        level.setTile(width - 1, y, TileType::TILE_WALL);
+    }
+
+    // Staggered platforms, reachable from one another with a single jump
+    for (int x = 6, step = 0; x + 6 < width - 1; x += 9, step++)
+    {
+        const int y = height - 6 - (step % 4) * 3;
+        for (int i = 0; i < 6; i++)
+        {
+            level.setTile(x + i, y, TileType::TILE_FLOOR);
+        }
+    }
+    return level;
+}
@@ -0,0 +1,294 @@
+#include <SDL3/SDL.h>
+#include <algorithm>
+#include <vector>
+
+#include "Gameplay/World.hpp"
+#include "Gameplay/EntitySystems.hpp"
+
+#include "Utils/Hash.hpp"
+#include "Utils/Profiler.hpp"
+
+#include "Common/Types.hpp"
+#include "Common/Constants.hpp"
+
+/**
+ * @brief Builds the test level and its flow graph, spawns the player on its floor and places one enemy on each platform.
+ */
+Gameplay::World::World()
+    : m_level(Tilemap::createTestLevel(4, 2))
+{
+    m_entities.reserve(Common::ENTITY_RESERVE);
+    m_flowField.build(m_level);
+    spawnEntities(createTestSpawns(m_level));
+}
+
+Gameplay::World::World(const Level &level)
+    : m_level(level.createTilemap())
+{
+    m_entities.reserve(Common::ENTITY_RESERVE);
+    m_flowField.build(m_level);
+    spawnEntities(level.getSpawns());
+}
+
+/**
+ * @brief Creates the player and enemies of a spawn table; with several player spawns, the last one wins.
+ */
+void Gameplay::World::spawnEntities(std::span<const LevelSpawn> spawns)
+{
+    for (const LevelSpawn &spawn : spawns)
+    {
+        if (spawn.kind == EntityKind::ENTITY_PLAYER)
+            m_player.spawn(m_entities, spawn.x, spawn.y);
+        else if (spawn.kind == EntityKind::ENTITY_ENEMY)
+            m_entities.create(EntityKind::ENTITY_ENEMY, spawn.x, spawn.y, Common::ENEMY_WIDTH, Common::ENEMY_HEIGHT, Common::TextureID::TEX_ENEMY);
+    }
+}
+
+/**
+ * @brief Attaches a worker pool and builds the per-step dependency graph.
+ *
+ * The graph runs the player first (it may spawn projectiles), then enemies (after retargeting the
+ * flow field at the player) and projectile movement side by side (neither creates nor destroys entities).
+ * Once both have moved, the spatial hash is rebuilt and projectiles touching an enemy are stopped;
+ * particle effects follow, reading player and projectile columns. Spent projectiles are removed
+ * last, with another rebuild if any were.
+ *
+ * @param jobs Worker pool, or nullptr to run single-threaded.
+ */
+void Gameplay::World::setJobSystem(Utils::JobSystem *jobs)
+{
+    m_jobs = jobs;
+    m_stepGraph = Utils::TaskGraph();
+    if (!m_jobs)
+        return;
+
+    auto player = m_stepGraph.add([this]
+                                  { beginStep(m_entities);
+                                    m_playerWasOnGround = isPlayerOnGround();
+                                    m_player.update(Common::TIME_STEP, m_stepInput, m_level, m_entities); });
+    auto enemies = m_stepGraph.add([this]
+                                   { updateFlowField();
+                                     updateEnemies(m_entities, m_level, Common::TIME_STEP, m_scratch, &m_flowField, m_jobs); });
+    auto projectiles = m_stepGraph.add([this]
+                                       { moveProjectiles(m_entities, m_level, Common::TIME_STEP, m_jobs); });
+    auto hits = m_stepGraph.add([this]
+                                { m_spatialHash.build(m_entities);
+                                  hitEnemies(m_entities, m_spatialHash, m_scratch); });
+    auto effects = m_stepGraph.add([this]
+                                   { updateEffects(); });
+    auto cleanup = m_stepGraph.add([this]
+                                   { removeSpent(); });
+
+    m_stepGraph.precede(player, enemies);
+    m_stepGraph.precede(player, projectiles);
+    m_stepGraph.precede(enemies, hits);
+    m_stepGraph.precede(projectiles, hits);
+    m_stepGraph.precede(hits, effects);
+    m_stepGraph.precede(effects, cleanup);
+}
+
+/**
+ * @brief Runs one fixed step: snapshot positions, then player, flow field, enemy, projectile, hit and particle systems, then removal of spent projectiles.
+ *
+ * @param input Input state sampled for this step.
+ */
+void Gameplay::World::step(const Common::InputState &input)
+{
+    PROFILE_ZONE("update");
+    if (m_jobs)
+    {
+        m_stepInput = input;
+        m_stepGraph.run(*m_jobs);
+        return;
+    }
+
+    beginStep(m_entities);
+    m_playerWasOnGround = isPlayerOnGround();
+    m_player.update(Common::TIME_STEP, input, m_level, m_entities);
+    updateFlowField();
+    updateEnemies(m_entities, m_level, Common::TIME_STEP, m_scratch, &m_flowField);
+    moveProjectiles(m_entities, m_level, Common::TIME_STEP);
+    m_spatialHash.build(m_entities);
+    hitEnemies(m_entities, m_spatialHash, m_scratch);
+    updateEffects();
+    removeSpent();
+}
+
+/**
+ * @brief Removes spent projectiles and, since that reorders the store, rebuilds the spatial hash if any went.
+ */
+void Gameplay::World::removeSpent()
+{
+    if (removeSpentProjectiles(m_entities) > 0)
+        m_spatialHash.build(m_entities);
+}
+
+bool Gameplay::World::isPlayerOnGround() const
+{
+    const size_t player = m_entities.indexOf(m_player.getHandle());
+    return player != EntityStore::NOT_FOUND && (m_entities.flags[player] & ENTITY_ON_GROUND) != 0;
+}
+
+void Gameplay::World::updateFlowField()
+{
+    const size_t player = m_entities.indexOf(m_player.getHandle());
+    if (player == EntityStore::NOT_FOUND)
+        return;
+    m_flowField.update(m_entities.posX[player] + m_entities.width[player] * 0.5f,
+                       m_entities.posY[player] + m_entities.height[player] - 1.0f, m_jobs);
+}
+
+void Gameplay::World::updateEffects()
+{
+    PROFILE_ZONE("particles");
+    m_soundEvents.clear();
+    const size_t player = m_entities.indexOf(m_player.getHandle());
+    const float listenerX = player != EntityStore::NOT_FOUND ? m_entities.posX[player] + m_entities.width[player] * 0.5f : 0.0f;
+    auto panAt = [listenerX](float x)
+    { return std::clamp((x - listenerX) / Common::SOUND_PAN_DISTANCE, -1.0f, 1.0f); };
+
+    if (m_player.firedThisStep())
+        m_soundEvents.push_back({Common::SoundID::SOUND_SHOOT, 0.0f});
+    if (player != EntityStore::NOT_FOUND && !m_playerWasOnGround && isPlayerOnGround())
+    {
+        m_particles.emit(LANDING_DUST, listenerX, m_entities.posY[player] + m_entities.height[player]);
+        m_soundEvents.push_back({Common::SoundID::SOUND_LAND, 0.0f});
+    }
+
+    const size_t count = m_entities.size();
+    for (size_t i = 0; i < count; i++)
+    {
+        if (m_entities.kind[i] != EntityKind::ENTITY_PROJECTILE)
+            continue;
+        const float centerX = m_entities.posX[i] + m_entities.width[i] * 0.5f;
+        const float centerY = m_entities.posY[i] + m_entities.height[i] * 0.5f;
+        // Spent this step (hit a wall or ran out of lifetime): spray sparks back along the flight path
+        if (m_entities.lifetime[i] <= 0.0f)
+        {
+            m_particles.emit(HIT_SPARKS, centerX, centerY, m_entities.velX[i] < 0.0f);
+            m_soundEvents.push_back({Common::SoundID::SOUND_HIT, panAt(centerX)});
+        }
+        else
+            m_particles.emit(PROJECTILE_TRAIL, centerX, centerY);
+    }
+
+    m_particles.update(Common::TIME_STEP);
+}
+
+/**
+ * @brief Centers the camera on the interpolated player, then gathers visible chunks and entities.
+ *
+ * With a worker pool, each range of Gameplay::ENTITY_JOB_GRAIN entities is turned into commands by
+ * its own job, writing to its own bucket; buckets are appended to `out` in a fixed order so the
+ * output is identical to the single-threaded path.
+ *
+ * @param alpha Fraction of a simulation step elapsed since the last step, in [0, 1].
+ * @param out Command list the frame's entity commands are appended to.
+ * @param staticOut List the visible chunks' static-layer commands are appended to.
+ */
+void Gameplay::World::collectRenderCommands(float alpha, Utils::FrameVector<Common::RenderCommand> &out,
+                                            Utils::FrameVector<Common::StaticChunkCommand> &staticOut)
+{
+    PROFILE_ZONE("collectRenderCommands");
+    const size_t player = m_entities.indexOf(m_player.getHandle());
+    if (player != EntityStore::NOT_FOUND)
+    {
+        const float x = m_entities.prevX[player] + (m_entities.posX[player] - m_entities.prevX[player]) * alpha;
+        const float y = m_entities.prevY[player] + (m_entities.posY[player] - m_entities.prevY[player]) * alpha;
+        m_camera.follow(x + m_entities.width[player] * 0.5f, y + m_entities.height[player] * 0.5f,
+                        m_level.getPixelWidth(), m_level.getPixelHeight());
+    }
+
+    m_level.collectStaticChunks(m_camera, staticOut);
+
+    if (!m_jobs)
+    {
+        Gameplay::collectRenderCommands(m_entities, m_camera, alpha, out);
+        return;
+    }
+
+    const size_t bucketCount = (m_entities.size() + ENTITY_JOB_GRAIN - 1) / ENTITY_JOB_GRAIN;
+    // Rebuilt from scratch each frame: last frame's bucket storage went away with its arena reset, so it
+    // must not be reused through assignment
+    m_commandBuckets.clear();
+    m_commandBuckets.resize(bucketCount, Utils::FrameVector<Common::RenderCommand>(out.get_allocator()));
+
+    m_jobs->parallelFor(bucketCount, 1, [&](size_t begin, size_t end)
+                        {
+                            for (size_t job = begin; job < end; job++)
+                            {
+                                const size_t first = job * ENTITY_JOB_GRAIN;
+                                const size_t last = std::min(m_entities.size(), first + ENTITY_JOB_GRAIN);
+                                Gameplay::collectRenderCommands(m_entities, m_camera, alpha, first, last, m_commandBuckets[job]);
+                            } });
+
+    size_t total = out.size();
+    for (size_t job = 0; job < bucketCount; job++)
+    {
+        total += m_commandBuckets[job].size();
+    }
+    out.reserve(total);
+    for (size_t job = 0; job < bucketCount; job++)
+    {
+        out.insert(out.end(), m_commandBuckets[job].begin(), m_commandBuckets[job].end());
+    }
+}
+
+void Gameplay::World::collectParticles(float alpha, Utils::FrameVector<Common::ParticleInstance> &out) const
+{
+    PROFILE_ZONE("collectParticles");
+    m_particles.collectInstances(m_camera, alpha, out);
+}
+
+Common::StreamFocus Gameplay::World::getStreamFocus() const
+{
+    Common::StreamFocus focus;
+    const size_t player = m_entities.indexOf(m_player.getHandle());
+    if (player == EntityStore::NOT_FOUND)
+        return focus;
+    focus.x = m_entities.posX[player] + m_entities.width[player] * 0.5f;
+    focus.y = m_entities.posY[player] + m_entities.height[player] * 0.5f;
+    focus.velX = m_entities.velX[player];
+    focus.velY = m_entities.velY[player];
+    return focus;
+}
+
+void Gameplay::World::saveSnapshot(WorldSnapshot &out) const
+{
+    PROFILE_ZONE("saveSnapshot");
+    out.clear();
+    m_entities.save(out);
+    m_player.save(out);
+}
+
+bool Gameplay::World::restoreSnapshot(const WorldSnapshot &snapshot)
+{
+    PROFILE_ZONE("restoreSnapshot");
+    SnapshotReader in(snapshot);
+    if (!m_entities.load(in) || !m_player.load(in))
+    {
+        SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "World snapshot of %zu bytes is truncated", snapshot.size());
+        return false;
+    }
+    m_particles.clear();
+    m_soundEvents.clear();
+    m_spatialHash.build(m_entities);
+    return true;
+}
+
+/**
+ * @brief FNV-1a over the entity count and each SoA column in turn.
+ */
+uint64_t Gameplay::World::computeStateHash() const
+{
+    const size_t count = m_entities.size();
+    uint64_t hash = Utils::fnv1a(&count, sizeof(count));
+    hash = Utils::fnv1a(m_entities.posX.data(), count * sizeof(float), hash);
+    hash = Utils::fnv1a(m_entities.posY.data(), count * sizeof(float), hash);
+    hash = Utils::fnv1a(m_entities.velX.data(), count * sizeof(float), hash);
+    hash = Utils::fnv1a(m_entities.velY.data(), count * sizeof(float), hash);
+    hash = Utils::fnv1a(m_entities.lifetime.data(), count * sizeof(float), hash);
+    hash = Utils::fnv1a(m_entities.kind.data(), count * sizeof(EntityKind), hash);
+    hash = Utils::fnv1a(m_entities.flags.data(), count * sizeof(uint8_t), hash);
+    return hash;
+}
@@ -0,0 +1,142 @@
+#include <algorithm>
+#include <cstring>
+#include <vector>
+
+#include "Gameplay/WorldSnapshot.hpp"
+
+namespace
+{
+    /**
+     * @brief Compares one SNAPSHOT_BLOCK_SIZE block as 64-bit words; the fixed-size loop is unrolled and vectorized.
+     */
+    bool blocksEqual(const uint8_t *a, const uint8_t *b)
+    {
+        uint64_t difference = 0;
+        for (size_t offset = 0; offset < Gameplay::SNAPSHOT_BLOCK_SIZE; offset += sizeof(uint64_t))
+        {
+            uint64_t x, y;
+            std::memcpy(&x, a + offset, sizeof(x));
+            std::memcpy(&y, b + offset, sizeof(y));
+            difference |= x ^ y;
+        }
+        return difference == 0;
+    }
+}
+
+/**
+ * @brief Grows the backing buffer geometrically, so appending a column at a time stays amortized.
+ */
+void Gameplay::WorldSnapshot::resize(size_t size)
+{
+    if (size > m_bytes.size())
+        m_bytes.resize(std::max(size, m_bytes.size() * 2));
+    m_size = size;
+}
+
+Gameplay::SnapshotHistory::SnapshotHistory(size_t capacity)
+    : m_deltas(std::max<size_t>(capacity, 1) - 1)
+{
+}
+
+/**
+ * @brief Records the blocks of the current newest snapshot that `snapshot` changes, then overwrites just those.
+ *
+ * Snapshot sizes are multiples of SNAPSHOT_BLOCK_SIZE (WorldSnapshot pads every column). Blocks
+ * past the end of the new snapshot are all recorded, so the delta can regrow the old one.
+ */
+void Gameplay::SnapshotHistory::push(const WorldSnapshot &snapshot)
+{
+    if (m_newest.empty() || m_deltas.empty())
+    {
+        m_newest.resize(snapshot.size());
+        std::memcpy(m_newest.data(), snapshot.data(), snapshot.size());
+        return;
+    }
+
+    Delta &delta = m_deltas[m_nextDelta];
+    m_nextDelta = (m_nextDelta + 1) % m_deltas.size();
+    m_deltaCount = std::min(m_deltaCount + 1, m_deltas.size());
+
+    const size_t oldBlocks = m_newest.size() / SNAPSHOT_BLOCK_SIZE;
+    const size_t newBlocks = snapshot.size() / SNAPSHOT_BLOCK_SIZE;
+    const size_t sharedBlocks = std::min(oldBlocks, newBlocks);
+    delta.size = m_newest.size();
+    delta.changedBlocks = 0;
+
+    // The slot's vectors only grow (doubling), so once the ring has wrapped a push rarely allocates
+    auto record = [&delta](size_t block, const uint8_t *content)
+    {
+        if (delta.changedBlocks == delta.blocks.size())
+        {
+            delta.blocks.resize(std::max<size_t>(delta.blocks.size() * 2, 64));
+            delta.bytes.resize(delta.blocks.size() * SNAPSHOT_BLOCK_SIZE);
+        }
+        delta.blocks[delta.changedBlocks] = (uint32_t)block;
+        std::memcpy(delta.bytes.data() + delta.changedBlocks * SNAPSHOT_BLOCK_SIZE, content, SNAPSHOT_BLOCK_SIZE);
+        delta.changedBlocks++;
+    };
+
+    uint8_t *current = m_newest.data();
+    const uint8_t *next = snapshot.data();
+    for (size_t block = 0; block < sharedBlocks; block++)
+    {
+        uint8_t *currentBlock = current + block * SNAPSHOT_BLOCK_SIZE;
+        const uint8_t *nextBlock = next + block * SNAPSHOT_BLOCK_SIZE;
+        if (blocksEqual(currentBlock, nextBlock))
+            continue;
+        record(block, currentBlock);
+        std::memcpy(currentBlock, nextBlock, SNAPSHOT_BLOCK_SIZE);
+    }
+    for (size_t block = sharedBlocks; block < oldBlocks; block++)
+        record(block, current + block * SNAPSHOT_BLOCK_SIZE);
+
+    m_newest.resize(snapshot.size());
+    if (newBlocks > sharedBlocks)
+    {
+        const size_t offset = sharedBlocks * SNAPSHOT_BLOCK_SIZE;
+        std::memcpy(m_newest.data() + offset, next + offset, snapshot.size() - offset);
+    }
+}
+
+/**
+ * @brief Applies the newest `frames` deltas to the newest snapshot, newest first, and frees their slots.
+ */
+bool Gameplay::SnapshotHistory::rollBack(size_t frames)
+{
+    if (m_newest.empty() || frames > m_deltaCount)
+        return false;
+
+    for (size_t i = 0; i < frames; i++)
+    {
+        m_nextDelta = (m_nextDelta + m_deltas.size() - 1) % m_deltas.size();
+        m_deltaCount--;
+        const Delta &delta = m_deltas[m_nextDelta];
+
+        m_newest.resize(delta.size);
+        uint8_t *current = m_newest.data();
+        for (size_t j = 0; j < delta.changedBlocks; j++)
+        {
+            std::memcpy(current + (size_t)delta.blocks[j] * SNAPSHOT_BLOCK_SIZE, delta.bytes.data() + j * SNAPSHOT_BLOCK_SIZE,
+                        SNAPSHOT_BLOCK_SIZE);
+        }
+    }
+    return true;
+}
+
+void Gameplay::SnapshotHistory::clear()
+{
+    m_newest.clear();
+    m_nextDelta = 0;
+    m_deltaCount = 0;
+}
+
+size_t Gameplay::SnapshotHistory::getDeltaBytes() const
+{
+    size_t bytes = 0;
+    for (size_t i = 0; i < m_deltaCount; i++)
+    {
+        const Delta &delta = m_deltas[(m_nextDelta + m_deltas.size() - 1 - i) % m_deltas.size()];
+        bytes += delta.changedBlocks * (SNAPSHOT_BLOCK_SIZE + sizeof(uint32_t));
+    }
+    return bytes;
+}
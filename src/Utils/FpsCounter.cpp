@@ -0,0 +1,67 @@
+#include <algorithm>
+#include <functional>
+
+#include "Utils/FpsCounter.hpp"
+
+namespace
+{
+    double toMs(uint64_t ns) { return (double)ns / 1'000'000.0; }
+}
+
+namespace Utils
+{
+    /**
+     * @brief Adds one frame, evicting the oldest once the window is full.
+     *
+     * @param frameNs Frame duration in nanoseconds.
+     */
+    void FpsCounter::addFrame(uint64_t frameNs)
+    {
+        if (m_count == FPS_WINDOW_FRAMES)
+        {
+            const double evicted = toMs(m_samples[m_next]);
+            m_sum -= evicted;
+            m_sumSquares -= evicted * evicted;
+        }
+        else
+        {
+            m_count++;
+        }
+
+        const double ms = toMs(frameNs);
+        m_samples[m_next] = frameNs;
+        m_sum += ms;
+        m_sumSquares += ms * ms;
+        m_next = (m_next + 1) % FPS_WINDOW_FRAMES;
+    }
+
+    FrameStats FpsCounter::getStats() const
+    {
+        FrameStats stats;
+        stats.frames = m_count;
+        if (m_count == 0)
+            return stats;
+
+        const auto window = m_samples.begin();
+        const auto [minIt, maxIt] = std::minmax_element(window, window + m_count);
+        stats.minMs = toMs(*minIt);
+        stats.maxMs = toMs(*maxIt);
+
+        stats.averageMs = m_sum / m_count;
+        // Running sums drift slightly as samples are evicted; clamp the rounding error away
+        stats.varianceMs2 = std::max(0.0, m_sumSquares / m_count - stats.averageMs * stats.averageMs);
+        stats.averageFps = stats.averageMs > 0.0 ? 1000.0 / stats.averageMs : 0.0;
+
+        // The slowest 1% of frames end up first, in any order
+        const size_t lowCount = std::max<size_t>(1, m_count / 100);
+        std::copy(window, window + m_count, m_sorted.begin());
+        std::nth_element(m_sorted.begin(), m_sorted.begin() + (lowCount - 1), m_sorted.begin() + m_count, std::greater<uint64_t>());
+        uint64_t lowNs = 0;
+        for (size_t i = 0; i < lowCount; i++)
+        {
+            lowNs += m_sorted[i];
+        }
+        stats.onePercentLowFps = lowNs > 0 ? 1000.0 * lowCount / toMs(lowNs) : 0.0;
+        return stats;
+    }
+} // namespace Utils
@@ -0,0 +1,75 @@
+#include <algorithm>
+#include <new>
+
+#include "Utils/FrameArena.hpp"
+
+namespace
+{
+    constexpr size_t ARENA_ALIGNMENT = 64; // Cache line, so arena blocks never share one with the heap
+}
+
+namespace Utils
+{
+    FrameArena::FrameArena(size_t capacity)
+        : m_buffer(static_cast<std::byte *>(::operator new(capacity, std::align_val_t(ARENA_ALIGNMENT)))), m_capacity(capacity)
+    {
+    }
+
+    FrameArena::~FrameArena()
+    {
+        reset();
+        ::operator delete(m_buffer, std::align_val_t(ARENA_ALIGNMENT));
+    }
+
+    /**
+     * @brief Bumps the shared offset with a compare-and-swap loop; falls back to an aligned heap block when full.
+     */
+    void *FrameArena::allocate(size_t size, size_t alignment)
+    {
+        size_t offset = m_offset.load(std::memory_order_relaxed);
+        while (true)
+        {
+            const size_t aligned = (offset + alignment - 1) & ~(alignment - 1);
+            if (aligned + size > m_capacity)
+                break;
+            if (m_offset.compare_exchange_weak(offset, aligned + size, std::memory_order_relaxed))
+                return m_buffer + aligned;
+        }
+
+        void *memory = ::operator new(size, std::align_val_t(alignment));
+        std::lock_guard<std::mutex> lock(m_overflowMutex);
+        m_overflow.push_back({memory, alignment});
+        m_overflowAllocations++;
+        m_overflowBytes += size;
+        return memory;
+    }
+
+    /**
+     * @brief Records the high-water mark, frees overflow blocks and rewinds the offset to zero.
+     */
+    void FrameArena::reset()
+    {
+        m_highWaterMark = std::max(m_highWaterMark, m_offset.load(std::memory_order_relaxed));
+        m_offset.store(0, std::memory_order_relaxed);
+
+        std::lock_guard<std::mutex> lock(m_overflowMutex);
+        for (const OverflowBlock &block : m_overflow)
+        {
+            ::operator delete(block.memory, std::align_val_t(block.alignment));
+        }
+        m_overflow.clear();
+    }
+
+    ArenaStats FrameArena::getStats() const
+    {
+        ArenaStats stats;
+        stats.capacity = m_capacity;
+        stats.used = m_offset.load(std::memory_order_relaxed);
+        stats.highWaterMark = std::max(m_highWaterMark, stats.used);
+
+        std::lock_guard<std::mutex> lock(m_overflowMutex);
+        stats.overflowAllocations = m_overflowAllocations;
+        stats.overflowBytes = m_overflowBytes;
+        return stats;
+    }
+} // namespace Utils
@@ -0,0 +1,70 @@
+#include <thread>
+
+#include "Utils/FrameTimer.hpp"
+
+namespace Utils
+{
+    FrameClock::FrameClock() : m_last(nowNs()) {}
+
+    /**
+     * @brief Converts the performance counter to nanoseconds.
+     *
+     * Whole seconds and the remainder are scaled separately so the multiplication cannot overflow
+     * for any realistic uptime or counter frequency.
+     */
+    uint64_t FrameClock::nowNs()
+    {
+        static const uint64_t frequency = SDL_GetPerformanceFrequency();
+        const uint64_t counter = SDL_GetPerformanceCounter();
+        return (counter / frequency) * NS_PER_SECOND + (counter % frequency) * NS_PER_SECOND / frequency;
+    }
+
+    uint64_t FrameClock::tick()
+    {
+        const uint64_t now = nowNs();
+        const uint64_t elapsed = now - m_last;
+        m_last = now;
+        return elapsed;
+    }
+
+    FrameLimiter::FrameLimiter(double targetFps)
+    {
+        setTarget(targetFps);
+    }
+
+    void FrameLimiter::setTarget(double targetFps)
+    {
+        m_periodNs = targetFps > 0.0 ? (uint64_t)(NS_PER_SECOND / targetFps) : 0;
+        m_deadline = 0;
+    }
+
+    void FrameLimiter::wait()
+    {
+        if (!isEnabled())
+            return;
+
+        uint64_t now = FrameClock::nowNs();
+        if (m_deadline == 0)
+        {
+            m_deadline = now + m_periodNs;
+            return;
+        }
+
+        // More than a frame behind (stall, window drag): restart the schedule instead of rushing to catch up
+        if (now > m_deadline + m_periodNs)
+        {
+            m_deadline = now + m_periodNs;
+            return;
+        }
+
+        if (now + SPIN_MARGIN_NS < m_deadline)
+        {
+            SDL_DelayNS(m_deadline - now - SPIN_MARGIN_NS);
+        }
+        while (FrameClock::nowNs() < m_deadline)
+        {
+            std::this_thread::yield();
+        }
+        m_deadline += m_periodNs;
+    }
+} // namespace Utils
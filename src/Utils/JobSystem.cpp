@@ -0,0 +1,247 @@
+#include <algorithm>
+#include <functional>
+#include <mutex>
+#include <string>
+#include <thread>
+
+#include "Utils/JobSystem.hpp"
+#include "Utils/Profiler.hpp"
+
+namespace
+{
+    // Identifies the pool (and the queue inside it) the current thread works for
+    thread_local const Utils::JobSystem *t_ownerSystem = nullptr;
+    thread_local int t_workerIndex = -1;
+}
+
+namespace Utils
+{
+    /**
+     * @brief Creates one queue per worker and starts the worker threads.
+     *
+     * @param workerCount Number of workers; 0 picks hardware threads - 1, at least one.
+     */
+    JobSystem::JobSystem(unsigned workerCount)
+    {
+        if (workerCount == 0)
+        {
+            const unsigned hardware = std::thread::hardware_concurrency();
+            workerCount = hardware > 1 ? hardware - 1 : 1;
+        }
+
+        for (unsigned i = 0; i < workerCount; i++)
+        {
+            m_queues.push_back(std::make_unique<WorkerQueue>());
+        }
+        for (unsigned i = 0; i < workerCount; i++)
+        {
+            m_workers.emplace_back(&JobSystem::workerLoop, this, i);
+        }
+    }
+
+    /**
+     * @brief Stops and joins all workers. Jobs still queued are discarded.
+     */
+    JobSystem::~JobSystem()
+    {
+        m_running.store(false);
+        {
+            std::lock_guard<std::mutex> lock(m_sleepMutex);
+        }
+        m_wakeCondition.notify_all();
+
+        for (auto &worker : m_workers)
+        {
+            worker.join();
+        }
+    }
+
+    /**
+     * @brief Pushes a job onto the caller's own deque when called from a worker, otherwise round-robin.
+     */
+    void JobSystem::submit(Job job, JobCounter *counter)
+    {
+        if (counter)
+            counter->pending.fetch_add(1, std::memory_order_relaxed);
+
+        const bool fromWorker = t_ownerSystem == this && t_workerIndex >= 0;
+        const size_t queueIndex = fromWorker ? (size_t)t_workerIndex : m_nextQueue.fetch_add(1, std::memory_order_relaxed) % m_queues.size();
+        {
+            std::lock_guard<std::mutex> lock(m_queues[queueIndex]->mutex);
+            m_queues[queueIndex]->tasks.push_back({std::move(job), counter});
+        }
+        m_queuedTasks.fetch_add(1, std::memory_order_release);
+
+        // Taking the sleep mutex orders this wake-up after a worker's "nothing queued" check
+        {
+            std::lock_guard<std::mutex> lock(m_sleepMutex);
+        }
+        m_wakeCondition.notify_one();
+    }
+
+    void JobSystem::wait(JobCounter &counter)
+    {
+        const int self = t_ownerSystem == this ? t_workerIndex : -1;
+        while (counter.pending.load(std::memory_order_acquire) > 0)
+        {
+            if (!tryRunOne(self))
+                std::this_thread::yield();
+        }
+    }
+
+    /**
+     * @brief Splits [0, count) into `grain`-sized ranges, queues one job per range and helps until all are done.
+     *
+     * Small inputs (a single range) run inline on the calling thread.
+     */
+    void JobSystem::parallelFor(size_t count, size_t grain, const std::function<void(size_t, size_t)> &body)
+    {
+        if (count == 0)
+            return;
+        grain = std::max<size_t>(1, grain);
+        if (count <= grain)
+        {
+            body(0, count);
+            return;
+        }
+
+        JobCounter counter;
+        for (size_t begin = 0; begin < count; begin += grain)
+        {
+            const size_t end = std::min(count, begin + grain);
+            submit([&body, begin, end]
+                   { body(begin, end); },
+                   &counter);
+        }
+        wait(counter);
+    }
+
+    void JobSystem::workerLoop(unsigned index)
+    {
+        t_ownerSystem = this;
+        t_workerIndex = (int)index;
+        PROFILE_THREAD(("Worker " + std::to_string(index)).c_str());
+
+        while (m_running.load(std::memory_order_acquire))
+        {
+            if (tryRunOne((int)index))
+                continue;
+
+            std::unique_lock<std::mutex> lock(m_sleepMutex);
+            m_wakeCondition.wait(lock, [this]
+                                 { return m_queuedTasks.load(std::memory_order_acquire) > 0 || !m_running.load(std::memory_order_acquire); });
+        }
+    }
+
+    bool JobSystem::tryRunOne(int selfIndex)
+    {
+        Task task;
+        if (!popOrSteal(selfIndex, task))
+            return false;
+        run(task);
+        return true;
+    }
+
+    /**
+     * @brief Takes the newest job from the worker's own deque, or steals the oldest job from another deque.
+     *
+     * @param selfIndex Queue owned by the caller, or -1 for threads outside the pool (steal only).
+     */
+    bool JobSystem::popOrSteal(int selfIndex, Task &task)
+    {
+        if (m_queuedTasks.load(std::memory_order_acquire) <= 0)
+            return false;
+
+        const size_t queueCount = m_queues.size();
+        if (selfIndex >= 0)
+        {
+            WorkerQueue &own = *m_queues[(size_t)selfIndex];
+            std::lock_guard<std::mutex> lock(own.mutex);
+            if (!own.tasks.empty())
+            {
+                task = std::move(own.tasks.back());
+                own.tasks.pop_back();
+                m_queuedTasks.fetch_sub(1, std::memory_order_relaxed);
+                return true;
+            }
+        }
+
+        const size_t start = selfIndex >= 0 ? (size_t)selfIndex + 1 : m_nextQueue.load(std::memory_order_relaxed);
+        for (size_t i = 0; i < queueCount; i++)
+        {
+            WorkerQueue &victim = *m_queues[(start + i) % queueCount];
+            std::lock_guard<std::mutex> lock(victim.mutex);
+            if (!victim.tasks.empty())
+            {
+                task = std::move(victim.tasks.front());
+                victim.tasks.pop_front();
+                m_queuedTasks.fetch_sub(1, std::memory_order_relaxed);
+                return true;
+            }
+        }
+        return false;
+    }
+
+    void JobSystem::run(Task &task)
+    {
+        {
+            PROFILE_ZONE("job");
+            task.job();
+        }
+        if (task.counter)
+            task.counter->pending.fetch_sub(1, std::memory_order_release);
+    }
+
+    TaskGraph::NodeId TaskGraph::add(std::function<void()> job)
+    {
+        m_nodes.emplace_back();
+        m_nodes.back().job = std::move(job);
+        return m_nodes.size() - 1;
+    }
+
+    void TaskGraph::precede(NodeId before, NodeId after)
+    {
+        m_nodes[before].successors.push_back(after);
+        m_nodes[after].predecessorCount++;
+    }
+
+    /**
+     * @brief Resets every node's dependency count, queues the nodes with no dependencies and waits.
+     */
+    void TaskGraph::run(JobSystem &jobs)
+    {
+        for (auto &node : m_nodes)
+        {
+            node.remaining.store(node.predecessorCount, std::memory_order_relaxed);
+        }
+
+        JobCounter counter;
+        for (NodeId id = 0; id < m_nodes.size(); id++)
+        {
+            if (m_nodes[id].predecessorCount == 0)
+                schedule(jobs, id, counter);
+        }
+        jobs.wait(counter);
+    }
+
+    /**
+     * @brief Queues a node; when it finishes, successors whose last dependency it was are queued in turn.
+     *
+     * Successors are queued before the node's own job counts as finished, so `counter` cannot reach
+     * zero while part of the graph is still pending.
+     */
+    void TaskGraph::schedule(JobSystem &jobs, NodeId id, JobCounter &counter)
+    {
+        jobs.submit([this, &jobs, id, &counter]
+                    {
+                        Node &node = m_nodes[id];
+                        if (node.job)
+                            node.job();
+                        for (NodeId successor : node.successors)
+                        {
+                            if (m_nodes[successor].remaining.fetch_sub(1, std::memory_order_acq_rel) == 1)
+                                schedule(jobs, successor, counter);
+                        } },
+                    &counter);
+    }
+} // namespace Utils
@@ -0,0 +1,135 @@
+#include <SDL3/SDL.h>
+#include <utility>
+
+#ifdef _WIN32
+#define WIN32_LEAN_AND_MEAN
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+#include "Utils/MappedFile.hpp"
+
+namespace Utils
+{
+    MappedFile::~MappedFile()
+    {
+        close();
+    }
+
+    MappedFile::MappedFile(MappedFile &&other) noexcept
+    {
+        *this = std::move(other);
+    }
+
+    MappedFile &MappedFile::operator=(MappedFile &&other) noexcept
+    {
+        if (this == &other)
+            return *this;
+        close();
+        m_data = std::exchange(other.m_data, nullptr);
+        m_size = std::exchange(other.m_size, 0);
+#ifdef _WIN32
+        m_file = std::exchange(other.m_file, nullptr);
+        m_mapping = std::exchange(other.m_mapping, nullptr);
+#endif
+        return *this;
+    }
+
+#ifdef _WIN32
+    bool MappedFile::open(const std::string &path)
+    {
+        close();
+        HANDLE file = CreateFileA(path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+        if (file == INVALID_HANDLE_VALUE)
+        {
+            SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Could not open %s", path.c_str());
+            return false;
+        }
+
+        LARGE_INTEGER size;
+        if (!GetFileSizeEx(file, &size) || size.QuadPart == 0)
+        {
+            SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "%s is empty or its size cannot be read", path.c_str());
+            CloseHandle(file);
+            return false;
+        }
+
+        HANDLE mapping = CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+        const void *view = mapping ? MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0) : nullptr;
+        if (!view)
+        {
+            SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Could not map %s (error %lu)", path.c_str(), GetLastError());
+            if (mapping)
+                CloseHandle(mapping);
+            CloseHandle(file);
+            return false;
+        }
+
+        m_data = (const uint8_t *)view;
+        m_size = (size_t)size.QuadPart;
+        m_file = file;
+        m_mapping = mapping;
+        return true;
+    }
+
+    void MappedFile::close()
+    {
+        if (m_data)
+            UnmapViewOfFile(m_data);
+        if (m_mapping)
+            CloseHandle((HANDLE)m_mapping);
+        if (m_file)
+            CloseHandle((HANDLE)m_file);
+        m_data = nullptr;
+        m_size = 0;
+        m_file = nullptr;
+        m_mapping = nullptr;
+    }
+#else
+    /**
+     * @brief Maps the file privately and read-only; the descriptor is closed right away since the mapping keeps the file alive.
+     */
+    bool MappedFile::open(const std::string &path)
+    {
+        close();
+        const int descriptor = ::open(path.c_str(), O_RDONLY);
+        if (descriptor < 0)
+        {
+            SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Could not open %s", path.c_str());
+            return false;
+        }
+
+        struct stat status;
+        if (fstat(descriptor, &status) != 0 || status.st_size <= 0)
+        {
+            SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "%s is empty or its size cannot be read", path.c_str());
+            ::close(descriptor);
+            return false;
+        }
+
+        void *view = mmap(nullptr, (size_t)status.st_size, PROT_READ, MAP_PRIVATE, descriptor, 0);
+        ::close(descriptor);
+        if (view == MAP_FAILED)
+        {
+            SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Could not map %s", path.c_str());
+            return false;
+        }
+
+        m_data = (const uint8_t *)view;
+        m_size = (size_t)status.st_size;
+        return true;
+    }
+
+    void MappedFile::close()
+    {
+        if (m_data)
+            munmap((void *)m_data, m_size);
+        m_data = nullptr;
+        m_size = 0;
+    }
+#endif
+} // namespace Utils
@@ -0,0 +1,216 @@
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cstdio>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+#include "Utils/Profiler.hpp"
+
+namespace
+{
+    struct ZoneEvent
+    {
+        const char *name;
+        uint64_t start;
+        uint64_t end;
+    };
+
+    // One per thread that ever recorded a zone; written only by that thread
+    struct ThreadBuffer
+    {
+        std::unique_ptr<ZoneEvent[]> events = std::make_unique<ZoneEvent[]>(Utils::PROFILER_EVENTS_PER_THREAD);
+        std::atomic<uint64_t> head{0}; // Total zones written; the ring holds the last PROFILER_EVENTS_PER_THREAD
+        std::string name;
+        size_t threadId = 0;
+    };
+
+    // Buffers are never freed, so zones of threads that have exited can still be exported
+    struct Registry
+    {
+        std::mutex mutex;
+        std::vector<std::unique_ptr<ThreadBuffer>> buffers;
+    };
+
+    Registry &registry()
+    {
+        static Registry instance;
+        return instance;
+    }
+
+    thread_local ThreadBuffer *t_buffer = nullptr;
+
+    ThreadBuffer &threadBuffer()
+    {
+        if (!t_buffer)
+        {
+            Registry &reg = registry();
+            std::lock_guard<std::mutex> lock(reg.mutex);
+            reg.buffers.push_back(std::make_unique<ThreadBuffer>());
+            t_buffer = reg.buffers.back().get();
+            t_buffer->threadId = reg.buffers.size();
+            t_buffer->name = "Thread " + std::to_string(t_buffer->threadId);
+        }
+        return *t_buffer;
+    }
+
+    // Frame-time histogram: fixed-width buckets plus a ring of the samples in the window, so the
+    // oldest sample can be taken back out of its bucket
+    constexpr double HISTOGRAM_BUCKET_MS = 0.1;
+    constexpr size_t HISTOGRAM_BUCKETS = 1000; // Last bucket collects everything from 99.9 ms up
+
+    struct FrameHistogram
+    {
+        std::array<uint32_t, HISTOGRAM_BUCKETS> counts{};
+        std::array<double, Utils::PROFILER_FRAME_WINDOW> samples{};
+        size_t next = 0;
+        size_t filled = 0;
+    };
+
+    FrameHistogram g_frames;
+
+    size_t bucketOf(double milliseconds)
+    {
+        const size_t bucket = (size_t)std::max(0.0, milliseconds / HISTOGRAM_BUCKET_MS);
+        return std::min(bucket, HISTOGRAM_BUCKETS - 1);
+    }
+
+    /**
+     * @brief Upper edge of the bucket containing the `fraction` quantile of the window.
+     */
+    double percentile(double fraction)
+    {
+        const size_t rank = std::max<size_t>(1, (size_t)(fraction * g_frames.filled + 0.999999));
+        size_t seen = 0;
+        for (size_t bucket = 0; bucket < HISTOGRAM_BUCKETS; bucket++)
+        {
+            seen += g_frames.counts[bucket];
+            if (seen >= rank)
+                return (bucket + 1) * HISTOGRAM_BUCKET_MS;
+        }
+        return HISTOGRAM_BUCKETS * HISTOGRAM_BUCKET_MS;
+    }
+
+    void writeJsonString(std::FILE *file, const char *text)
+    {
+        std::fputc('"', file);
+        for (const char *c = text; *c; c++)
+        {
+            if (*c == '"' || *c == '\\')
+                std::fputc('\\', file);
+            std::fputc(*c, file);
+        }
+        std::fputc('"', file);
+    }
+}
+
+namespace Utils
+{
+    namespace Profiler
+    {
+        void recordZone(const char *name, uint64_t start, uint64_t end)
+        {
+            ThreadBuffer &buffer = threadBuffer();
+            const uint64_t head = buffer.head.load(std::memory_order_relaxed);
+            buffer.events[head % PROFILER_EVENTS_PER_THREAD] = {name, start, end};
+            buffer.head.store(head + 1, std::memory_order_release);
+        }
+
+        void setThreadName(const char *name)
+        {
+            ThreadBuffer &buffer = threadBuffer();
+            std::lock_guard<std::mutex> lock(registry().mutex);
+            buffer.name = name;
+        }
+
+        void recordFrameTime(double seconds)
+        {
+            const double milliseconds = seconds * 1000.0;
+            if (g_frames.filled == PROFILER_FRAME_WINDOW)
+            {
+                g_frames.counts[bucketOf(g_frames.samples[g_frames.next])]--;
+            }
+            else
+            {
+                g_frames.filled++;
+            }
+            g_frames.samples[g_frames.next] = milliseconds;
+            g_frames.counts[bucketOf(milliseconds)]++;
+            g_frames.next = (g_frames.next + 1) % PROFILER_FRAME_WINDOW;
+        }
+
+        FrameTimeStats getFrameTimeStats()
+        {
+            FrameTimeStats stats;
+            stats.frames = g_frames.filled;
+            if (stats.frames == 0)
+                return stats;
+
+            stats.p50 = percentile(0.50);
+            stats.p99 = percentile(0.99);
+            stats.max = *std::max_element(g_frames.samples.begin(), g_frames.samples.begin() + g_frames.filled);
+            return stats;
+        }
+
+        /**
+         * @brief Emits one complete ("X") event per buffered zone plus a thread_name record per thread.
+         *
+         * Timestamps are microseconds since the earliest buffered zone.
+         */
+        bool writeChromeTrace(const std::string &path)
+        {
+            std::FILE *file = std::fopen(path.c_str(), "w");
+            if (!file)
+            {
+                SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Could not open trace file %s", path.c_str());
+                return false;
+            }
+
+            Registry &reg = registry();
+            std::lock_guard<std::mutex> lock(reg.mutex);
+
+            uint64_t origin = UINT64_MAX;
+            for (const auto &buffer : reg.buffers)
+            {
+                const uint64_t head = buffer->head.load(std::memory_order_acquire);
+                const uint64_t first = head > PROFILER_EVENTS_PER_THREAD ? head - PROFILER_EVENTS_PER_THREAD : 0;
+                for (uint64_t i = first; i < head; i++)
+                {
+                    origin = std::min(origin, buffer->events[i % PROFILER_EVENTS_PER_THREAD].start);
+                }
+            }
+            const double ticksToMicros = 1e6 / (double)SDL_GetPerformanceFrequency();
+
+            std::fputs("{\"traceEvents\":[\n", file);
+            bool firstEvent = true;
+            for (const auto &buffer : reg.buffers)
+            {
+                std::fprintf(file, "%s{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":%zu,\"args\":{\"name\":",
+                             firstEvent ? "" : ",\n", buffer->threadId);
+                writeJsonString(file, buffer->name.c_str());
+                std::fputs("}}", file);
+                firstEvent = false;
+
+                const uint64_t head = buffer->head.load(std::memory_order_acquire);
+                const uint64_t first = head > PROFILER_EVENTS_PER_THREAD ? head - PROFILER_EVENTS_PER_THREAD : 0;
+                for (uint64_t i = first; i < head; i++)
+                {
+                    const ZoneEvent &event = buffer->events[i % PROFILER_EVENTS_PER_THREAD];
+                    std::fputs(",\n{\"name\":", file);
+                    writeJsonString(file, event.name);
+                    std::fprintf(file, ",\"ph\":\"X\",\"pid\":1,\"tid\":%zu,\"ts\":%.3f,\"dur\":%.3f}", buffer->threadId,
+                                 (event.start - origin) * ticksToMicros, (event.end - event.start) * ticksToMicros);
+                }
+            }
+            std::fputs("\n]}\n", file);
+
+            if (std::fclose(file) != 0)
+            {
+                SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Failed to write trace file %s", path.c_str());
+                return false;
+            }
+            return true;
+        }
+    } // namespace Profiler
+} // namespace Utils
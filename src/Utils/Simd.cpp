@@ -0,0 +1,35 @@
+#include "Utils/Simd.hpp"
+
+namespace Utils
+{
+    SimdLevel detectSimdLevel()
+    {
+#if defined(__x86_64__) || defined(__i386__)
+        static const SimdLevel level = []
+        {
+            __builtin_cpu_init();
+            if (__builtin_cpu_supports("avx2"))
+                return SimdLevel::SIMD_AVX2;
+            if (__builtin_cpu_supports("sse2"))
+                return SimdLevel::SIMD_SSE;
+            return SimdLevel::SIMD_SCALAR;
+        }();
+        return level;
+#else
+        return SimdLevel::SIMD_SCALAR;
+#endif
+    }
+
+    const char *simdLevelName(SimdLevel level)
+    {
+        switch (level)
+        {
+        case SimdLevel::SIMD_AVX2:
+            return "avx2";
+        case SimdLevel::SIMD_SSE:
+            return "sse";
+        default:
+            return "scalar";
+        }
+    }
+} // namespace Utils
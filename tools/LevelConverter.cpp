@@ -0,0 +1,114 @@
+#include <SDL3/SDL.h>
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <string>
+#include <vector>
+
+#include "Gameplay/Level.hpp"
+#include "Gameplay/Tilemap.hpp"
+
+#include "Common/Constants.hpp"
+
+// Offline converter from text levels to the binary level format loaded with --level.
+//
+// Text levels are rows of characters, one per tile, top row first:
+//   '#' wall, '=' floor, '.' or ' ' empty,
+//   'P' player spawn and 'E' enemy spawn (both on an empty tile, standing on its bottom edge).
+// The map is padded with empty tiles to whole chunks. `--test WxH` writes the generated test
+// level of W x H chunks instead, e.g. `--test 128x128` for a 4096 x 4096 tile map.
+
+namespace
+{
+    bool readTextLevel(const std::string &path, Gameplay::Tilemap &map, std::vector<Gameplay::LevelSpawn> &spawns)
+    {
+        std::ifstream file(path);
+        if (!file)
+        {
+            SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Could not open %s", path.c_str());
+            return false;
+        }
+
+        std::vector<std::string> rows;
+        size_t width = 0;
+        for (std::string row; std::getline(file, row);)
+        {
+            if (!row.empty() && row.back() == '\r')
+                row.pop_back();
+            width = std::max(width, row.size());
+            rows.push_back(row);
+        }
+        if (rows.empty() || width == 0)
+        {
+            SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "%s is empty", path.c_str());
+            return false;
+        }
+
+        const int widthInChunks = (int)((width + Common::CHUNK_SIZE - 1) / Common::CHUNK_SIZE);
+        const int heightInChunks = (int)((rows.size() + Common::CHUNK_SIZE - 1) / Common::CHUNK_SIZE);
+        map = Gameplay::Tilemap(widthInChunks, heightInChunks);
+
+        for (int y = 0; y < (int)rows.size(); y++)
+        {
+            for (int x = 0; x < (int)rows[y].size(); x++)
+            {
+                const float tileBottom = (float)((y + 1) * Common::TILE_SIZE);
+                switch (rows[y][x])
+                {
+                case '#':
+                    map.setTile(x, y, Gameplay::TileType::TILE_WALL);
+                    break;
+                case '=':
+                    map.setTile(x, y, Gameplay::TileType::TILE_FLOOR);
+                    break;
+                case 'P':
+                    spawns.push_back({(float)(x * Common::TILE_SIZE), tileBottom - Common::PLAYER_HEIGHT, Gameplay::EntityKind::ENTITY_PLAYER});
+                    break;
+                case 'E':
+                    spawns.push_back({(float)(x * Common::TILE_SIZE), tileBottom - Common::ENEMY_HEIGHT, Gameplay::EntityKind::ENTITY_ENEMY});
+                    break;
+                case '.':
+                case ' ':
+                    break;
+                default:
+                    SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "%s:%d:%d: unknown tile '%c'", path.c_str(), y + 1, x + 1, rows[y][x]);
+                    return false;
+                }
+            }
+        }
+        return true;
+    }
+}
+
+int main(int argc, char *argv[])
+{
+    Gameplay::Tilemap map(1, 1);
+    std::vector<Gameplay::LevelSpawn> spawns;
+    int widthInChunks = 0, heightInChunks = 0;
+
+    if (argc == 4 && std::strcmp(argv[1], "--test") == 0 && std::sscanf(argv[2], "%dx%d", &widthInChunks, &heightInChunks) == 2 &&
+        widthInChunks > 0 && heightInChunks > 0)
+    {
+        map = Gameplay::Tilemap::createTestLevel(widthInChunks, heightInChunks);
+        spawns = Gameplay::createTestSpawns(map);
+    }
+    else if (argc == 3)
+    {
+        if (!readTextLevel(argv[1], map, spawns))
+            return 1;
+    }
+    else
+    {
+        SDL_Log("Usage: %s <level.txt> <out.lvl> | --test <W>x<H> <out.lvl>", argv[0]);
+        return 1;
+    }
+
+    const char *outPath = argv[argc - 1];
+    if (!Gameplay::writeLevel(outPath, map, spawns))
+        return 1;
+    SDL_Log("Wrote %s: %d x %d chunks (%d x %d tiles), %zu spawns", outPath, map.getWidthInChunks(), map.getHeightInChunks(),
+            map.getWidthInTiles(), map.getHeightInTiles(), spawns.size());
+    return 0;
+}